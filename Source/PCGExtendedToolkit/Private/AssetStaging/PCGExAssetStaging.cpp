@@ -130,7 +130,6 @@ bool FPCGExAssetStagingElement::ExecuteInternal(FPCGContext* InContext) const
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
 			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExAssetStaging::FProcessor>>& NewBatch)
 			{
-				NewBatch->bRequiresWriteStep = Settings->bPruneEmptyPoints;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any points to process."));
@@ -308,18 +307,14 @@ namespace PCGExAssetStaging
 
 	void FProcessor::CompleteWork()
 	{
-		PointDataFacade->Write(AsyncManager);
-	}
-
-	void FProcessor::Write()
-	{
-		// TODO : Find a better solution
-		TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
-
-		int32 WriteIndex = 0;
-		for (int32 i = 0; i < NumPoints; i++) { if (MutablePoints[i].MetadataEntry != -2) { MutablePoints[WriteIndex++] = MutablePoints[i]; } }
+		if (Settings->bPruneEmptyPoints)
+		{
+			// Prune before writing so buffers are compacted along with points and never write to invalid entries
+			const TArray<FPCGPoint>& Points = PointDataFacade->GetOut()->GetPoints();
+			PointDataFacade->Compact([&](const int32 Index) { return Points[Index].MetadataEntry != -2; });
+		}
 
-		MutablePoints.SetNum(WriteIndex);
+		PointDataFacade->Write(AsyncManager);
 	}
 }
 
@@ -149,6 +149,30 @@ namespace PCGExData
 		WriteBuffersWithCallback->StartSimpleCallbacks();
 	}
 
+	int32 FFacade::Compact(const TArray<int32>& InReadIndices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FFacade::Compact);
+
+		TArray<FPCGPoint>& MutablePoints = Source->GetMutablePoints();
+		if (InReadIndices.Num() == MutablePoints.Num()) { return MutablePoints.Num(); }
+
+		PCGExMT::Gather(MutablePoints, InReadIndices);
+
+		// Cached keys point to the previous allocation
+		Source->CleanupKeys();
+
+		{
+			FReadScopeLock ReadScopeLock(BufferLock);
+			for (const TSharedPtr<FBufferBase>& Buffer : Buffers)
+			{
+				if (!Buffer.IsValid() || !Buffer->IsWritable()) { continue; }
+				Buffer->Gather(InReadIndices);
+			}
+		}
+
+		return MutablePoints.Num();
+	}
+
 	bool FFacade::ValidateOutputsBeforeWriting() const
 	{
 		FPCGExContext* Context = Source->GetContext();
@@ -4,21 +4,291 @@
 
 #include "Data/PCGExDataSharing.h"
 
+#include "PCGExGlobalSettings.h"
+#include "PCGExHelpers.h"
 #include "PCGExSubSystem.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace PCGExDataSharing
+{
+	static constexpr uint32 SpillMagic = 0x50434758; // PCGX
+	static constexpr uint32 SpillVersion = 1;
+
+	static std::atomic<uint64> AccessCounter{0};
+
+	uint64 GetAccessStamp() { return AccessCounter.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+	int64 GetResidentSize(const FPCGDataCollection& InCollection)
+	{
+		int64 Size = 0;
+		for (const FPCGTaggedData& TaggedData : InCollection.TaggedData)
+		{
+			const UPCGPointData* PointData = Cast<UPCGPointData>(TaggedData.Data);
+			if (!PointData) { continue; }
+
+			const TArray<FPCGPoint>& Points = PointData->GetPoints();
+			Size += Points.GetAllocatedSize();
+
+			// Rough estimate, assumes one value per point per attribute
+			if (PointData->Metadata) { Size += static_cast<int64>(PointData->Metadata->GetAttributeCount()) * Points.Num() * sizeof(FVector); }
+		}
+		return Size;
+	}
+
+	FString GetSpillDirectory()
+	{
+		return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("PCGEx"), TEXT("SharedData"));
+	}
+
+	void DeleteSpillFile(FItemInfos& InInfos)
+	{
+		if (InInfos.SpillPath.IsEmpty()) { return; }
+		IFileManager::Get().Delete(*InInfos.SpillPath, false, false, true);
+		InInfos.SpillPath.Empty();
+	}
+
+	static void SerializeMetadata(FArchive& Ar, const UPCGPointData* InData)
+	{
+		const TArray<FPCGPoint>& Points = InData->GetPoints();
+		const UPCGMetadata* Metadata = InData->Metadata;
+
+		TArray<FName> Names;
+		TArray<EPCGMetadataTypes> Types;
+		Metadata->GetAttributes(Names, Types);
+
+		int32 NumAttributes = Names.Num();
+		Ar << NumAttributes;
+
+		for (int i = 0; i < NumAttributes; i++)
+		{
+			const FPCGMetadataAttributeBase* Attribute = Metadata->GetConstAttribute(Names[i]);
+
+			FName Name = Names[i];
+			int16 TypeId = Attribute->GetTypeId();
+			bool bAllowsInterpolation = Attribute->AllowsInterpolation();
+
+			Ar << Name;
+			Ar << TypeId;
+			Ar << bAllowsInterpolation;
+
+			PCGEx::ExecuteWithRightType(
+				TypeId, [&](auto DummyValue)
+				{
+					using T = decltype(DummyValue);
+					const FPCGMetadataAttribute<T>* TypedAttribute = static_cast<const FPCGMetadataAttribute<T>*>(Attribute);
+
+					T DefaultValue = TypedAttribute->GetValue(PCGDefaultValueKey);
+					Ar << DefaultValue;
+
+					for (const FPCGPoint& Point : Points)
+					{
+						T Value = TypedAttribute->GetValueFromItemKey(Point.MetadataEntry);
+						Ar << Value;
+					}
+				});
+		}
+	}
+
+	static void DeserializeMetadata(FArchive& Ar, UPCGPointData* InData)
+	{
+		TArray<FPCGPoint>& Points = InData->GetMutablePoints();
+		UPCGMetadata* Metadata = InData->Metadata;
+
+		// Data was flattened when written, so each point gets a fresh entry
+		for (FPCGPoint& Point : Points) { Point.MetadataEntry = Metadata->AddEntry(); }
+
+		int32 NumAttributes = 0;
+		Ar << NumAttributes;
+
+		for (int i = 0; i < NumAttributes; i++)
+		{
+			FName Name = NAME_None;
+			int16 TypeId = 0;
+			bool bAllowsInterpolation = false;
+
+			Ar << Name;
+			Ar << TypeId;
+			Ar << bAllowsInterpolation;
+
+			PCGEx::ExecuteWithRightType(
+				TypeId, [&](auto DummyValue)
+				{
+					using T = decltype(DummyValue);
+
+					T DefaultValue = T{};
+					Ar << DefaultValue;
+
+					FPCGMetadataAttribute<T>* TypedAttribute = Metadata->CreateAttribute<T>(Name, DefaultValue, bAllowsInterpolation, false);
+
+					for (const FPCGPoint& Point : Points)
+					{
+						T Value = T{};
+						Ar << Value;
+						if (TypedAttribute) { TypedAttribute->SetValue(Point.MetadataEntry, Value); }
+					}
+				});
+		}
+	}
+
+	bool WriteToDisk(const FString& InPath, const FPCGDataCollection& InCollection, TArray<int32>& OutSpilledIndices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDataSharing::WriteToDisk);
+
+		OutSpilledIndices.Reset();
+
+		for (int i = 0; i < InCollection.TaggedData.Num(); i++)
+		{
+			if (Cast<UPCGPointData>(InCollection.TaggedData[i].Data)) { OutSpilledIndices.Add(i); }
+		}
+
+		if (OutSpilledIndices.IsEmpty()) { return false; }
+
+		TArray64<uint8> Bytes;
+		FMemoryWriter64 Ar(Bytes);
+
+		uint32 Magic = SpillMagic;
+		uint32 Version = SpillVersion;
+		int32 NumEntries = OutSpilledIndices.Num();
+
+		Ar << Magic;
+		Ar << Version;
+		Ar << NumEntries;
+
+		for (int32 Index : OutSpilledIndices)
+		{
+			const UPCGPointData* PointData = Cast<UPCGPointData>(InCollection.TaggedData[Index].Data);
+			const TArray<FPCGPoint>& Points = PointData->GetPoints();
+
+			FString ClassPath = PointData->GetClass()->GetPathName();
+			int32 NumPoints = Points.Num();
+
+			Ar << Index;
+			Ar << ClassPath;
+			Ar << NumPoints;
+
+			// Raw point block, the cache is local to this process so layout is stable
+			Ar.Serialize(const_cast<FPCGPoint*>(Points.GetData()), static_cast<int64>(NumPoints) * sizeof(FPCGPoint));
+
+			SerializeMetadata(Ar, PointData);
+		}
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(InPath), true);
+		if (!FFileHelper::SaveArrayToFile(Bytes, *InPath))
+		{
+			OutSpilledIndices.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	static bool ReadFromArchive(FArchive& Ar, FPCGDataCollection& InOutCollection)
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int32 NumEntries = 0;
+
+		Ar << Magic;
+		Ar << Version;
+		Ar << NumEntries;
+
+		if (Magic != SpillMagic || Version != SpillVersion) { return false; }
+
+		for (int e = 0; e < NumEntries; e++)
+		{
+			int32 Index = -1;
+			FString ClassPath;
+			int32 NumPoints = 0;
+
+			Ar << Index;
+			Ar << ClassPath;
+			Ar << NumPoints;
+
+			if (Ar.IsError() || !InOutCollection.TaggedData.IsValidIndex(Index)) { return false; }
+
+			UClass* DataClass = FindObject<UClass>(nullptr, *ClassPath);
+			if (!DataClass || !DataClass->IsChildOf(UPCGPointData::StaticClass())) { DataClass = UPCGPointData::StaticClass(); }
+
+			UPCGPointData* PointData = nullptr;
+
+			{
+				FGCScopeGuard Scope;
+				PointData = Cast<UPCGPointData>(NewObject<UObject>(GetTransientPackage(), DataClass));
+			}
+
+			if (PointData->HasAnyInternalFlags(EInternalObjectFlags::Async)) { PointData->ClearInternalFlags(EInternalObjectFlags::Async); }
+
+			TArray<FPCGPoint>& Points = PointData->GetMutablePoints();
+			Points.SetNumUninitialized(NumPoints);
+			Ar.Serialize(Points.GetData(), static_cast<int64>(NumPoints) * sizeof(FPCGPoint));
+
+			DeserializeMetadata(Ar, PointData);
+
+			if (Ar.IsError()) { return false; }
+
+			InOutCollection.TaggedData[Index].Data = PointData;
+		}
+
+		return true;
+	}
+
+	bool ReadFromDisk(const FString& InPath, FPCGDataCollection& InOutCollection)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDataSharing::ReadFromDisk);
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*InPath);
+		if (!MappedResult.HasError())
+		{
+			const TUniquePtr<IMappedFileHandle> MappedHandle = MappedResult.StealValue();
+			const TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle ? MappedHandle->MapRegion() : nullptr);
+
+			if (MappedRegion)
+			{
+				FMemoryReaderView Ar(MakeArrayView(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()));
+				return ReadFromArchive(Ar, InOutCollection);
+			}
+		}
+
+		// Platform doesn't support mapping, fall back to a regular read
+		TArray64<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *InPath)) { return false; }
+
+		FMemoryReaderView Ar(MakeArrayView(Bytes.GetData(), Bytes.Num()));
+		return ReadFromArchive(Ar, InOutCollection);
+	}
+}
 
 void UPCGExDataBucket::Append(UPCGComponent* InSource, const uint32 Item, const FPCGDataCollection& InData)
 {
-	FWriteScopeLock WriteScopeLock(ContentLock);
-	FPCGDataCollection* CollectionPtr = Content.Find(Item);
-	if (!CollectionPtr)
+	bool bIsNewItem = false;
+
 	{
-		Content.Add(Item, InData);
-		return;
+		FWriteScopeLock WriteScopeLock(ContentLock);
+		FPCGDataCollection* CollectionPtr = Content.Find(Item);
+		if (!CollectionPtr)
+		{
+			Content.Add(Item, InData);
+			bIsNewItem = true;
+		}
+		else
+		{
+			Rehydrate_Unsafe(Item);
+			CollectionPtr->TaggedData.Append(InData.TaggedData);
+		}
+
+		OnContentChanged_Unsafe(Item);
 	}
 
-	FPCGDataCollection& Collection = *CollectionPtr;
-	Collection.TaggedData.Append(Collection.TaggedData);
-	OnUpdate(InSource, Item);
+	if (!bIsNewItem) { OnUpdate(InSource, Item); }
+	if (Manager.IsValid()) { Manager->EnforceMemoryBudget(); }
 }
 
 void UPCGExDataBucket::Remove(UPCGComponent* InSource, const uint32 Item, const FPCGDataCollection& InData)
@@ -30,28 +300,68 @@ void UPCGExDataBucket::Remove(UPCGComponent* InSource, const uint32 Item, const
 
 void UPCGExDataBucket::Replace(UPCGComponent* InSource, const uint32 Item, const FPCGDataCollection& InData)
 {
-	FWriteScopeLock WriteScopeLock(ContentLock);
-	Content.Add(Item, InData);
+	{
+		FWriteScopeLock WriteScopeLock(ContentLock);
+		Content.Add(Item, InData);
+		OnContentChanged_Unsafe(Item);
+	}
+
 	OnUpdate(InSource, Item);
+	if (Manager.IsValid()) { Manager->EnforceMemoryBudget(); }
 }
 
 int32 UPCGExDataBucket::Grab(const uint32 Item, FPCGDataCollection& OutData, FDataFilterFunc&& Filter)
 {
 	if (bFlushing) { return 0; }
 
-	FReadScopeLock ReadScopeLock(ContentLock);
-	FPCGDataCollection* CollectionPtr = Content.Find(Item);
+	// LRU stamps are only needed to pick eviction candidates
+	const bool bTrackAccess = GetDefault<UPCGExGlobalSettings>()->bSharedDataSpillToDisk;
+
+	auto GatherData = [&](const FPCGDataCollection& InCollection)
+	{
+		int32 AddCount = 0;
+		for (const FPCGTaggedData& TaggedData : InCollection.TaggedData)
+		{
+			if (!TaggedData.Data || !Filter(TaggedData)) { continue; }
+			OutData.TaggedData.Add(TaggedData);
+			AddCount++;
+		}
+		return AddCount;
+	};
 
-	if (!CollectionPtr) { return 0; }
+	{
+		// Resident data only needs shared access, so concurrent consumers don't serialize
+		FReadScopeLock ReadScopeLock(ContentLock);
+		const FPCGDataCollection* CollectionPtr = Content.Find(Item);
+
+		if (!CollectionPtr) { return 0; }
+
+		const PCGExDataSharing::FItemInfos* ItemInfos = Infos.Find(Item);
+		if (!ItemInfos || !ItemInfos->IsSpilled())
+		{
+			if (bTrackAccess && ItemInfos) { ItemInfos->Touch(); }
+			return GatherData(*CollectionPtr);
+		}
+	}
 
 	int32 AddCount = 0;
-	for (const FPCGTaggedData& TaggedData : CollectionPtr->TaggedData)
+	bool bRehydrated = false;
+
 	{
-		if (!Filter(TaggedData)) { continue; }
-		OutData.TaggedData.Add(TaggedData);
-		AddCount++;
+		// Spilled data must be reloaded from disk, which requires exclusive access
+		FWriteScopeLock WriteScopeLock(ContentLock);
+		const FPCGDataCollection* CollectionPtr = Content.Find(Item);
+
+		if (!CollectionPtr) { return 0; }
+
+		bRehydrated = Rehydrate_Unsafe(Item);
+		if (const PCGExDataSharing::FItemInfos* ItemInfos = Infos.Find(Item)) { ItemInfos->Touch(); }
+
+		AddCount = GatherData(*CollectionPtr);
 	}
 
+	if (bRehydrated && Manager.IsValid()) { Manager->EnforceMemoryBudget(); }
+
 	return AddCount;
 }
 
@@ -68,11 +378,108 @@ void UPCGExDataBucket::Flush()
 		// TODO : Implement
 	}
 
+	for (TPair<uint32, PCGExDataSharing::FItemInfos>& Pair : Infos) { PCGExDataSharing::DeleteSpillFile(Pair.Value); }
+
 	Content.Empty();
+	Infos.Empty();
 
 	bFlushing = false;
 }
 
+void UPCGExDataBucket::GatherResidentItems(TArray<PCGExDataSharing::FResidentItem>& OutItems, int64& OutTotalSize) const
+{
+	FReadScopeLock ReadScopeLock(ContentLock);
+
+	for (const TPair<uint32, PCGExDataSharing::FItemInfos>& Pair : Infos)
+	{
+		if (Pair.Value.IsSpilled() || Pair.Value.ResidentSize <= 0) { continue; }
+
+		PCGExDataSharing::FResidentItem& ResidentItem = OutItems.Emplace_GetRef();
+		ResidentItem.Bucket = const_cast<UPCGExDataBucket*>(this);
+		ResidentItem.Item = Pair.Key;
+		ResidentItem.LastAccess = Pair.Value.LastAccess.load(std::memory_order_relaxed);
+		ResidentItem.Size = Pair.Value.ResidentSize;
+
+		OutTotalSize += Pair.Value.ResidentSize;
+	}
+}
+
+int64 UPCGExDataBucket::Evict(const uint32 Item)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExDataBucket::Evict);
+
+	FWriteScopeLock WriteScopeLock(ContentLock);
+
+	FPCGDataCollection* CollectionPtr = Content.Find(Item);
+	PCGExDataSharing::FItemInfos* ItemInfos = Infos.Find(Item);
+
+	if (!CollectionPtr || !ItemInfos || ItemInfos->IsSpilled()) { return 0; }
+
+	TArray<int32> SpilledIndices;
+
+	if (ItemInfos->SpillPath.IsEmpty())
+	{
+		const FString Path = FPaths::Combine(PCGExDataSharing::GetSpillDirectory(), FString::Printf(TEXT("%u_%u_%s.bin"), BucketId, Item, *FGuid::NewGuid().ToString()));
+		if (!PCGExDataSharing::WriteToDisk(Path, *CollectionPtr, SpilledIndices)) { return 0; }
+		ItemInfos->SpillPath = Path;
+	}
+	else
+	{
+		// Up-to-date copy already on disk from a previous eviction
+		for (int i = 0; i < CollectionPtr->TaggedData.Num(); i++) { if (Cast<UPCGPointData>(CollectionPtr->TaggedData[i].Data)) { SpilledIndices.Add(i); } }
+	}
+
+	// Release references so GC can reclaim the point data
+	for (const int32 Index : SpilledIndices) { CollectionPtr->TaggedData[Index].Data = nullptr; }
+
+	const int64 Freed = ItemInfos->ResidentSize;
+
+	ItemInfos->SpilledIndices = MoveTemp(SpilledIndices);
+	ItemInfos->ResidentSize = 0;
+
+	return Freed;
+}
+
+void UPCGExDataBucket::OnContentChanged_Unsafe(const uint32 Item)
+{
+	PCGExDataSharing::FItemInfos& ItemInfos = Infos.FindOrAdd(Item);
+
+	// Whatever is on disk is now stale
+	PCGExDataSharing::DeleteSpillFile(ItemInfos);
+	ItemInfos.SpilledIndices.Reset();
+
+	ItemInfos.Touch();
+	ItemInfos.ResidentSize = PCGExDataSharing::GetResidentSize(Content.FindChecked(Item));
+}
+
+bool UPCGExDataBucket::Rehydrate_Unsafe(const uint32 Item)
+{
+	PCGExDataSharing::FItemInfos* ItemInfos = Infos.Find(Item);
+	if (!ItemInfos || !ItemInfos->IsSpilled()) { return false; }
+
+	FPCGDataCollection& Collection = Content.FindChecked(Item);
+
+	if (!PCGExDataSharing::ReadFromDisk(ItemInfos->SpillPath, Collection))
+	{
+		UE_LOG(LogTemp, Error, TEXT("PCGEx : Failed to reload spilled shared data from '%s'"), *ItemInfos->SpillPath);
+
+		// Drop entries we can't recover rather than handing out null data
+		for (const int32 Index : ItemInfos->SpilledIndices) { Collection.TaggedData[Index].Data = nullptr; }
+		Collection.TaggedData.RemoveAll([](const FPCGTaggedData& TaggedData) { return !TaggedData.Data; });
+
+		PCGExDataSharing::DeleteSpillFile(*ItemInfos);
+		ItemInfos->SpilledIndices.Reset();
+		ItemInfos->ResidentSize = PCGExDataSharing::GetResidentSize(Collection);
+		return false;
+	}
+
+	// Keep the file around, if the item is evicted again untouched it won't need to be rewritten
+	ItemInfos->SpilledIndices.Reset();
+	ItemInfos->ResidentSize = PCGExDataSharing::GetResidentSize(Collection);
+
+	return true;
+}
+
 void UPCGExDataBucket::OnUpdate(UPCGComponent* InSource, uint32 Item) const
 {
 	PCGEX_SUBSYSTEM
@@ -92,6 +499,7 @@ void UPCGExSharedDataManager::PushData(UPCGComponent* InSource, uint32 BucketId,
 		}
 
 		Bucket->BucketId = BucketId;
+		Bucket->Manager = this;
 		if (Bucket->HasAnyInternalFlags(EInternalObjectFlags::Async)) { Bucket->ClearInternalFlags(EInternalObjectFlags::Async); }
 
 		Buckets.Add(BucketId, Bucket);
@@ -123,7 +531,6 @@ TObjectPtr<UPCGExDataBucket> UPCGExSharedDataManager::FindBucket(const uint32 Bu
 
 void UPCGExSharedDataManager::FlushBucket(uint32 BucketId)
 {
-	FWriteScopeLock WriteScopeLock(BucketLock);
 	TObjectPtr<UPCGExDataBucket> Bucket = FindBucket(BucketId);
 	if (Bucket.Get()) { Bucket->Flush(); }
 }
@@ -141,3 +548,34 @@ void UPCGExSharedDataManager::Flush()
 
 	for (const TObjectPtr<UPCGExDataBucket>& Bucket : BucketArray) { Bucket->Flush(); }
 }
+
+void UPCGExSharedDataManager::EnforceMemoryBudget()
+{
+	const UPCGExGlobalSettings* GlobalSettings = GetDefault<UPCGExGlobalSettings>();
+	if (!GlobalSettings->bSharedDataSpillToDisk) { return; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSharedDataManager::EnforceMemoryBudget);
+
+	// Only one eviction pass at a time
+	FWriteScopeLock BudgetScopeLock(BudgetLock);
+
+	const int64 Budget = GlobalSettings->GetSharedDataMemoryBudget();
+
+	TArray<PCGExDataSharing::FResidentItem> ResidentItems;
+	int64 TotalSize = 0;
+
+	// Held for the whole pass : gathered items point to buckets, which a concurrent Flush would otherwise release
+	FReadScopeLock ReadScopeLock(BucketLock);
+
+	for (const TPair<uint32, TObjectPtr<UPCGExDataBucket>>& Pair : Buckets) { Pair.Value->GatherResidentItems(ResidentItems, TotalSize); }
+
+	if (TotalSize <= Budget) { return; }
+
+	ResidentItems.Sort([](const PCGExDataSharing::FResidentItem& A, const PCGExDataSharing::FResidentItem& B) { return A.LastAccess < B.LastAccess; });
+
+	for (const PCGExDataSharing::FResidentItem& ResidentItem : ResidentItems)
+	{
+		if (TotalSize <= Budget) { break; }
+		TotalSize -= ResidentItem.Bucket->Evict(ResidentItem.Item);
+	}
+}
@@ -10,6 +10,60 @@
 
 namespace PCGExData
 {
+#pragma region FPointsCache
+
+	namespace PointsCache
+	{
+		template <typename T, typename FReadFunc>
+		static TConstArrayView<T> GetOrBuild(FRWLock& Lock, TArray<T>& Cache, const UPCGPointData* Data, FReadFunc&& Read)
+		{
+			const int32 NumPoints = Data ? Data->GetPoints().Num() : 0;
+
+			{
+				FReadScopeLock ReadScopeLock(Lock);
+				if (Cache.Num() == NumPoints) { return Cache; }
+			}
+
+			{
+				FWriteScopeLock WriteScopeLock(Lock);
+				if (Cache.Num() == NumPoints) { return Cache; }
+
+				const TArray<FPCGPoint>& Points = Data->GetPoints();
+				Cache.SetNumUninitialized(NumPoints);
+
+				PCGExMT::ParallelForBlocking(
+					FMath::DivideAndRoundUp(NumPoints, PCGExMT::CompactionScopeSize), [&](const int32 ScopeIndex)
+					{
+						const int32 Start = ScopeIndex * PCGExMT::CompactionScopeSize;
+						const int32 End = FMath::Min(Start + PCGExMT::CompactionScopeSize, NumPoints);
+						for (int i = Start; i < End; i++) { Cache[i] = Read(Points[i]); }
+					}, NumPoints <= PCGExMT::CompactionScopeSize);
+
+				return Cache;
+			}
+		}
+	}
+
+	TConstArrayView<FVector> FPointsCache::GetPositions()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointsCache::GetPositions);
+		return PointsCache::GetOrBuild(CacheLock, Positions, Data, [](const FPCGPoint& Point) { return Point.Transform.GetLocation(); });
+	}
+
+	TConstArrayView<FQuat> FPointsCache::GetRotations()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointsCache::GetRotations);
+		return PointsCache::GetOrBuild(CacheLock, Rotations, Data, [](const FPCGPoint& Point) { return Point.Transform.GetRotation(); });
+	}
+
+	TConstArrayView<FBox> FPointsCache::GetBounds()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointsCache::GetBounds);
+		return PointsCache::GetOrBuild(CacheLock, Bounds, Data, [](const FPCGPoint& Point) { return Point.GetLocalBounds().TransformBy(Point.Transform); });
+	}
+
+#pragma endregion
+
 #pragma region FPointIO
 
 	void FPointIO::SetInfos(
@@ -105,6 +159,23 @@ namespace PCGExData
 		return InKeys;
 	}
 
+	TSharedPtr<FPointsCache> FPointIO::GetInPointsCache()
+	{
+		{
+			FReadScopeLock ReadScopeLock(InKeysLock);
+			if (InPointsCache) { return InPointsCache; }
+		}
+
+		{
+			FWriteScopeLock WriteScopeLock(InKeysLock);
+			if (InPointsCache) { return InPointsCache; }
+			if (const TSharedPtr<FPointIO> PinnedRoot = RootIO.Pin(); PinnedRoot && PinnedRoot->GetIn() == In) { InPointsCache = PinnedRoot->GetInPointsCache(); }
+			else { InPointsCache = MakeShared<FPointsCache>(In); }
+		}
+
+		return InPointsCache;
+	}
+
 	TSharedPtr<FPCGAttributeAccessorKeysPoints> FPointIO::GetOutKeys(const bool bEnsureValidKeys)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPointIO::GetOutKeys);
@@ -116,21 +187,58 @@ namespace PCGExData
 			if (OutKeys) { return OutKeys; }
 		}
 
+		// A single owner initializes the keys; InitPoints runs parallel passes, which must not happen while holding OutKeysLock
+		FWriteScopeLock InitScopeLock(OutKeysInitLock);
+
 		{
-			FWriteScopeLock WriteScopeLock(OutKeysLock);
+			FReadScopeLock ReadScopeLock(OutKeysLock);
 			if (OutKeys) { return OutKeys; }
-			const TArrayView<FPCGPoint> MutablePoints = MakeArrayView(Out->GetMutablePoints());
+		}
 
-			if (bEnsureValidKeys)
-			{
-				UPCGMetadata* OutMetadata = Out->Metadata;
-				for (FPCGPoint& Pt : MutablePoints) { OutMetadata->InitializeOnSet(Pt.MetadataEntry); }
-			}
+		const TArrayView<FPCGPoint> MutablePoints = MakeArrayView(Out->GetMutablePoints());
+		if (bEnsureValidKeys) { InitPoints(MutablePoints); }
 
-			OutKeys = MakeShared<FPCGAttributeAccessorKeysPoints>(MutablePoints);
+		TSharedPtr<FPCGAttributeAccessorKeysPoints> NewKeys = MakeShared<FPCGAttributeAccessorKeysPoints>(MutablePoints);
+
+		{
+			FWriteScopeLock WriteScopeLock(OutKeysLock);
+			OutKeys = NewKeys;
 		}
 
-		return OutKeys;
+		return NewKeys;
+	}
+
+	void FPointIO::InitPoints(const TArrayView<FPCGPoint>& Points) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPointIO::InitPoints);
+
+		UPCGMetadata* Metadata = Out->Metadata;
+
+		// Keys below the offset belong to the parent metadata and get a child entry, invalid keys get a fresh one
+		const int64 ItemKeyOffset = Metadata->GetItemKeyCountForParent() - Metadata->GetLocalItemCount();
+
+		TArray<int32> WriteIndices;
+		const int32 NumEntries = PCGExMT::GetCompactionIndices(
+			WriteIndices, Points.Num(),
+			[&](const int32 i) { return Points[i].MetadataEntry < ItemKeyOffset; });
+
+		if (!NumEntries) { return; }
+
+		TArray<PCGMetadataEntryKey> ParentKeys;
+		ParentKeys.SetNumUninitialized(NumEntries);
+		PCGExMT::ParallelForBlocking(NumEntries, [&](const int32 i) { ParentKeys[i] = Points[WriteIndices[i]].MetadataEntry; });
+
+		const TArray<PCGMetadataEntryKey> EntryKeys = Metadata->AddEntries(ParentKeys);
+
+		PCGExMT::ParallelForBlocking(NumEntries, [&](const int32 i) { Points[WriteIndices[i]].MetadataEntry = EntryKeys[i]; });
+	}
+
+	void FPointIO::InitPoints(const int32 StartIndex, const int32 Count) const
+	{
+		TArray<FPCGPoint>& MutablePoints = Out->GetMutablePoints();
+		const int32 SafeCount = Count < 0 ? MutablePoints.Num() - StartIndex : Count;
+		if (SafeCount <= 0) { return; }
+		InitPoints(MakeArrayView(MutablePoints.GetData() + StartIndex, SafeCount));
 	}
 
 	void FPointIO::PrintOutKeysMap(TMap<PCGMetadataEntryKey, int32>& InMap) const
@@ -347,24 +455,8 @@ namespace PCGExData
 
 	void FPointIOCollection::PruneNullEntries(const bool bUpdateIndices)
 	{
-		const int32 MaxPairs = Pairs.Num();
-		int32 WriteIndex = 0;
-		if (!bUpdateIndices)
-		{
-			for (int32 i = 0; i < MaxPairs; i++) { if (Pairs[i]) { Pairs[WriteIndex++] = Pairs[i]; } }
-		}
-		else
-		{
-			for (int32 i = 0; i < MaxPairs; i++)
-			{
-				if (Pairs[i])
-				{
-					Pairs[i]->IOIndex = WriteIndex;
-					Pairs[WriteIndex++] = Pairs[i];
-				}
-			}
-		}
-		Pairs.SetNum(WriteIndex);
+		PCGExMT::Compact(Pairs, [&](const int32 Index) { return Pairs[Index].IsValid(); });
+		if (bUpdateIndices) { for (int32 i = 0; i < Pairs.Num(); i++) { Pairs[i]->IOIndex = i; } }
 	}
 
 	void FPointIOCollection::Flush()
@@ -0,0 +1,615 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoBVH.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "StaticMeshResources.h"
+
+namespace PCGExGeo
+{
+#pragma region BVH
+
+	namespace BVH
+	{
+		constexpr int32 MaxLeafSize = 4;
+		constexpr int32 NumBins = 16;
+		constexpr int32 ParallelThreshold = 8192;
+
+		struct FBin
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Count = 0;
+		};
+
+		struct FBuildTask
+		{
+			int32 Node = 0;
+			int32 Start = 0;
+			int32 Count = 0;
+		};
+
+		FORCEINLINE double HalfArea(const FBox& InBox)
+		{
+			if (!InBox.IsValid) { return 0; }
+			const FVector E = InBox.GetSize();
+			return E.X * E.Y + E.Y * E.Z + E.Z * E.X;
+		}
+
+		class FBuilder
+		{
+			const TArray<FBox>& ItemBounds;
+			TArray<FVector> Centroids;
+			TArray<FBVHNode>& Nodes;
+			TArray<int32>& Order;
+			int32 NumNodes = 1;
+
+		public:
+			FBuilder(const TArray<FBox>& InItemBounds, TArray<FBVHNode>& OutNodes, TArray<int32>& OutOrder)
+				: ItemBounds(InItemBounds), Nodes(OutNodes), Order(OutOrder)
+			{
+				const int32 NumItems = ItemBounds.Num();
+
+				Centroids.SetNumUninitialized(NumItems);
+				PCGExMT::ParallelForBlocking(NumItems, [&](const int32 i) { Centroids[i] = ItemBounds[i].GetCenter(); }, NumItems <= ParallelThreshold);
+
+				PCGEx::ArrayOfIndices(Order, NumItems);
+				Nodes.SetNum(NumItems * 2 - 1);
+			}
+
+			void Build()
+			{
+				BuildSubtree(FBuildTask{0, 0, ItemBounds.Num()});
+				Nodes.SetNum(NumNodes);
+			}
+
+		protected:
+			bool Split(const FBuildTask& InTask, FBuildTask& OutLeft, FBuildTask& OutRight)
+			{
+				FBVHNode& Node = Nodes[InTask.Node];
+
+				const int32 Start = InTask.Start;
+				const int32 End = InTask.Start + InTask.Count;
+
+				TArray<PCGExMT::FScope> Scopes;
+				const int32 NumScopes = InTask.Count > ParallelThreshold ? PCGExMT::SubLoopScopes(Scopes, InTask.Count, ParallelThreshold) : 0;
+
+				// Node bounds & centroid bounds
+
+				FBox CentroidBounds = FBox(ForceInit);
+				Node.Bounds = FBox(ForceInit);
+
+				if (NumScopes)
+				{
+					TArray<FBox> ScopedBounds;
+					TArray<FBox> ScopedCentroids;
+					ScopedBounds.Init(FBox(ForceInit), NumScopes);
+					ScopedCentroids.Init(FBox(ForceInit), NumScopes);
+
+					PCGExMT::ParallelForBlocking(
+						NumScopes, [&](const int32 ScopeIndex)
+						{
+							const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+							for (int i = Start + Scope.Start; i < Start + Scope.End; i++)
+							{
+								ScopedBounds[ScopeIndex] += ItemBounds[Order[i]];
+								ScopedCentroids[ScopeIndex] += Centroids[Order[i]];
+							}
+						});
+
+					for (int i = 0; i < NumScopes; i++)
+					{
+						Node.Bounds += ScopedBounds[i];
+						CentroidBounds += ScopedCentroids[i];
+					}
+				}
+				else
+				{
+					for (int i = Start; i < End; i++)
+					{
+						Node.Bounds += ItemBounds[Order[i]];
+						CentroidBounds += Centroids[Order[i]];
+					}
+				}
+
+				if (InTask.Count <= MaxLeafSize)
+				{
+					Node.Start = Start;
+					Node.Count = InTask.Count;
+					return false;
+				}
+
+				const FVector CentroidSize = CentroidBounds.GetSize();
+				const int32 Axis = CentroidSize.X >= CentroidSize.Y ? (CentroidSize.X >= CentroidSize.Z ? 0 : 2) : (CentroidSize.Y >= CentroidSize.Z ? 1 : 2);
+				const double AxisMin = CentroidBounds.Min[Axis];
+				const double AxisSize = CentroidSize[Axis];
+
+				int32 NumLeft = InTask.Count / 2;
+
+				if (AxisSize > UE_SMALL_NUMBER)
+				{
+					const double Scale = NumBins / AxisSize;
+					auto GetBin = [&](const int32 Item) { return FMath::Min(NumBins - 1, static_cast<int32>((Centroids[Item][Axis] - AxisMin) * Scale)); };
+
+					// Binning
+
+					FBin Bins[NumBins];
+
+					if (NumScopes)
+					{
+						TArray<FBin> ScopedBins;
+						ScopedBins.SetNum(NumScopes * NumBins);
+
+						PCGExMT::ParallelForBlocking(
+							NumScopes, [&](const int32 ScopeIndex)
+							{
+								const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+								FBin* LocalBins = ScopedBins.GetData() + ScopeIndex * NumBins;
+								for (int i = Start + Scope.Start; i < Start + Scope.End; i++)
+								{
+									FBin& Bin = LocalBins[GetBin(Order[i])];
+									Bin.Bounds += ItemBounds[Order[i]];
+									Bin.Count++;
+								}
+							});
+
+						for (int i = 0; i < ScopedBins.Num(); i++)
+						{
+							FBin& Bin = Bins[i % NumBins];
+							Bin.Bounds += ScopedBins[i].Bounds;
+							Bin.Count += ScopedBins[i].Count;
+						}
+					}
+					else
+					{
+						for (int i = Start; i < End; i++)
+						{
+							FBin& Bin = Bins[GetBin(Order[i])];
+							Bin.Bounds += ItemBounds[Order[i]];
+							Bin.Count++;
+						}
+					}
+
+					// SAH sweep, split happens after bin at index
+
+					double RightCost[NumBins - 1];
+					FBox Accum = FBox(ForceInit);
+					int32 AccumCount = 0;
+
+					for (int i = NumBins - 1; i > 0; i--)
+					{
+						Accum += Bins[i].Bounds;
+						AccumCount += Bins[i].Count;
+						RightCost[i - 1] = AccumCount ? HalfArea(Accum) * AccumCount : -1;
+					}
+
+					int32 BestSplit = -1;
+					double BestCost = MAX_dbl;
+
+					Accum = FBox(ForceInit);
+					AccumCount = 0;
+
+					for (int i = 0; i < NumBins - 1; i++)
+					{
+						Accum += Bins[i].Bounds;
+						AccumCount += Bins[i].Count;
+						if (!AccumCount || RightCost[i] < 0) { continue; }
+
+						const double Cost = HalfArea(Accum) * AccumCount + RightCost[i];
+						if (Cost < BestCost)
+						{
+							BestCost = Cost;
+							BestSplit = i;
+						}
+					}
+
+					if (BestSplit != -1)
+					{
+						int32 L = Start;
+						int32 R = End - 1;
+						while (L <= R)
+						{
+							if (GetBin(Order[L]) <= BestSplit) { L++; }
+							else { Swap(Order[L], Order[R--]); }
+						}
+
+						NumLeft = L - Start;
+					}
+				}
+
+				// Degenerate distributions fall back to an arbitrary half split
+				if (NumLeft <= 0 || NumLeft >= InTask.Count) { NumLeft = InTask.Count / 2; }
+
+				const int32 FirstChild = FPlatformAtomics::InterlockedAdd(&NumNodes, 2);
+				Node.Start = FirstChild;
+				Node.Count = 0;
+
+				OutLeft = FBuildTask{FirstChild, Start, NumLeft};
+				OutRight = FBuildTask{FirstChild + 1, Start + NumLeft, InTask.Count - NumLeft};
+
+				return true;
+			}
+
+			void BuildSubtree(const FBuildTask& InTask)
+			{
+				TArray<FBuildTask, TInlineAllocator<64>> Stack;
+				Stack.Add(InTask);
+
+				while (!Stack.IsEmpty())
+				{
+#if PCGEX_ENGINE_VERSION <= 503
+					const FBuildTask Task = Stack.Pop(false);
+#else
+					const FBuildTask Task = Stack.Pop(EAllowShrinking::No);
+#endif
+
+					FBuildTask Left;
+					FBuildTask Right;
+					if (!Split(Task, Left, Right)) { continue; }
+
+					if (Left.Count > ParallelThreshold && Right.Count > ParallelThreshold)
+					{
+						// Both halves are large enough to be worth building side by side
+						PCGExMT::ParallelForBlocking(2, [&](const int32 i) { BuildSubtree(i ? Right : Left); });
+						continue;
+					}
+
+					Stack.Add(Left);
+					Stack.Add(Right);
+				}
+			}
+		};
+	}
+
+	void BuildBVH(const TArray<FBox>& InItemBounds, TArray<FBVHNode>& OutNodes, TArray<int32>& OutOrder)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::BuildBVH);
+
+		OutNodes.Reset();
+		OutOrder.Reset();
+
+		if (InItemBounds.IsEmpty()) { return; }
+
+		BVH::FBuilder Builder(InItemBounds, OutNodes, OutOrder);
+		Builder.Build();
+	}
+
+#pragma endregion
+
+#pragma region FTriangleBVH
+
+	bool FTriangleBVH::AddPrimitive(UPrimitiveComponent* InPrimitive)
+	{
+		check(Nodes.IsEmpty()) // Can't add primitives once built
+
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(InPrimitive);
+		if (!StaticMeshComponent) { return false; }
+
+		const UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
+		if (!StaticMesh) { return false; }
+
+#if !WITH_EDITOR
+		if (!StaticMesh->bAllowCPUAccess) { return false; }
+#endif
+
+		const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+		if (!RenderData || RenderData->LODResources.IsEmpty()) { return false; }
+
+		const FStaticMeshLODResources& LODResources = RenderData->LODResources[0];
+		const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FIndexArrayView Indices = LODResources.IndexBuffer.GetArrayView();
+
+		const int32 NumVertices = VertexBuffer.GetNumVertices();
+		if (!NumVertices || !Indices.Num()) { return false; }
+
+		TArray<FTransform> Transforms;
+		if (const UInstancedStaticMeshComponent* InstancedComponent = Cast<UInstancedStaticMeshComponent>(StaticMeshComponent))
+		{
+			const int32 NumInstances = InstancedComponent->GetInstanceCount();
+			Transforms.Reserve(NumInstances);
+			for (int i = 0; i < NumInstances; i++)
+			{
+				FTransform InstanceTransform;
+				if (InstancedComponent->GetInstanceTransform(i, InstanceTransform, true)) { Transforms.Add(InstanceTransform); }
+			}
+		}
+		else
+		{
+			Transforms.Add(StaticMeshComponent->GetComponentTransform());
+		}
+
+		// One surface per section, so physical materials follow section materials
+
+		UPhysicalMaterial* FallbackPhysMat = StaticMeshComponent->GetBodyInstance() ? StaticMeshComponent->GetBodyInstance()->GetSimplePhysicalMaterial() : nullptr;
+		AActor* Owner = StaticMeshComponent->GetOwner();
+
+		const int32 SurfaceOffset = Surfaces.Num();
+		for (const FStaticMeshSection& Section : LODResources.Sections)
+		{
+			FTriangleSurface& Surface = Surfaces.Emplace_GetRef();
+			Surface.Component = StaticMeshComponent;
+			Surface.Actor = Owner;
+
+			const UMaterialInterface* Material = StaticMeshComponent->GetMaterial(Section.MaterialIndex);
+			UPhysicalMaterial* PhysMat = Material ? Material->GetPhysicalMaterial() : nullptr;
+			Surface.PhysMat = PhysMat ? PhysMat : FallbackPhysMat;
+		}
+
+		int32 NumSectionTriangles = 0;
+		for (const FStaticMeshSection& Section : LODResources.Sections) { NumSectionTriangles += static_cast<int32>(Section.NumTriangles); }
+
+		Vertices.Reserve(Vertices.Num() + NumVertices * Transforms.Num());
+		Triangles.Reserve(Triangles.Num() + NumSectionTriangles * Transforms.Num());
+		TriangleSurfaces.Reserve(TriangleSurfaces.Num() + NumSectionTriangles * Transforms.Num());
+		TriangleFaces.Reserve(TriangleFaces.Num() + NumSectionTriangles * Transforms.Num());
+
+		for (const FTransform& Transform : Transforms)
+		{
+			const int32 VertexOffset = Vertices.Num();
+			for (int i = 0; i < NumVertices; i++) { Vertices.Add(Transform.TransformPosition(FVector(VertexBuffer.VertexPosition(i)))); }
+
+			// Mirrored transforms flip the winding
+			const bool bFlip = Transform.GetDeterminant() < 0;
+
+			for (int s = 0; s < LODResources.Sections.Num(); s++)
+			{
+				const FStaticMeshSection& Section = LODResources.Sections[s];
+				const int32 FirstIndex = static_cast<int32>(Section.FirstIndex);
+				const int32 LastIndex = FirstIndex + static_cast<int32>(Section.NumTriangles) * 3;
+				for (int i = FirstIndex; i < LastIndex; i += 3)
+				{
+					const int32 A = VertexOffset + static_cast<int32>(Indices[i]);
+					const int32 B = VertexOffset + static_cast<int32>(Indices[i + 1]);
+					const int32 C = VertexOffset + static_cast<int32>(Indices[i + 2]);
+
+					Triangles.Add(bFlip ? FIntVector3(A, C, B) : FIntVector3(A, B, C));
+					TriangleSurfaces.Add(SurfaceOffset + s);
+					TriangleFaces.Add(i / 3);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	void FTriangleBVH::Build()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTriangleBVH::Build);
+
+		const int32 NumItems = Triangles.Num();
+		if (!NumItems) { return; }
+
+		TArray<FBox> TriangleBounds;
+		TriangleBounds.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelForBlocking(
+			NumItems, [&](const int32 i)
+			{
+				const FIntVector3& T = Triangles[i];
+				FBox Box = FBox(ForceInit);
+				Box += Vertices[T.X];
+				Box += Vertices[T.Y];
+				Box += Vertices[T.Z];
+				TriangleBounds[i] = Box;
+			}, NumItems <= BVH::ParallelThreshold);
+
+		TArray<int32> Order;
+		BuildBVH(TriangleBounds, Nodes, Order);
+
+		// Store triangles in leaf order so leaves reference contiguous ranges
+
+		TArray<FIntVector3> OrderedTriangles;
+		TArray<int32> OrderedSurfaces;
+		TArray<int32> OrderedFaces;
+		OrderedTriangles.SetNumUninitialized(NumItems);
+		OrderedSurfaces.SetNumUninitialized(NumItems);
+		OrderedFaces.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelForBlocking(
+			NumItems, [&](const int32 i)
+			{
+				OrderedTriangles[i] = Triangles[Order[i]];
+				OrderedSurfaces[i] = TriangleSurfaces[Order[i]];
+				OrderedFaces[i] = TriangleFaces[Order[i]];
+			}, NumItems <= BVH::ParallelThreshold);
+
+		Triangles = MoveTemp(OrderedTriangles);
+		TriangleSurfaces = MoveTemp(OrderedSurfaces);
+		TriangleFaces = MoveTemp(OrderedFaces);
+	}
+
+	bool FTriangleBVH::FindClosest(const FVector& Origin, const double MaxDistance, FTriangleHit& OutHit) const
+	{
+		if (Nodes.IsEmpty()) { return false; }
+
+		double BestDistSquared = FMath::Square(MaxDistance);
+		if (Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Origin) > BestDistSquared) { return false; }
+
+		int32 BestTriangle = -1;
+		FVector BestLocation = Origin;
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+#if PCGEX_ENGINE_VERSION <= 503
+			const FBVHNode& Node = Nodes[Stack.Pop(false)];
+#else
+			const FBVHNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+
+			// Best distance may have shrunk since this node was pushed
+			if (Node.Bounds.ComputeSquaredDistanceToPoint(Origin) > BestDistSquared) { continue; }
+
+			if (Node.Count)
+			{
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const FIntVector3& T = Triangles[i];
+					const FVector Closest = FMath::ClosestPointOnTriangleToPoint(Origin, Vertices[T.X], Vertices[T.Y], Vertices[T.Z]);
+					const double DistSquared = FVector::DistSquared(Origin, Closest);
+					if (DistSquared > BestDistSquared) { continue; }
+
+					BestDistSquared = DistSquared;
+					BestLocation = Closest;
+					BestTriangle = i;
+				}
+				continue;
+			}
+
+			// Push the farthest child first so the closest one is visited first
+			const int32 Left = Node.Start;
+			const int32 Right = Node.Start + 1;
+			const double LeftDist = Nodes[Left].Bounds.ComputeSquaredDistanceToPoint(Origin);
+			const double RightDist = Nodes[Right].Bounds.ComputeSquaredDistanceToPoint(Origin);
+
+			if (LeftDist <= RightDist)
+			{
+				if (RightDist <= BestDistSquared) { Stack.Add(Right); }
+				if (LeftDist <= BestDistSquared) { Stack.Add(Left); }
+			}
+			else
+			{
+				if (LeftDist <= BestDistSquared) { Stack.Add(Left); }
+				if (RightDist <= BestDistSquared) { Stack.Add(Right); }
+			}
+		}
+
+		if (BestTriangle == -1) { return false; }
+
+		OutHit.Location = BestLocation;
+		OutHit.Normal = GetTriangleNormal(BestTriangle);
+		OutHit.Distance = FMath::Sqrt(BestDistSquared);
+		OutHit.Triangle = BestTriangle;
+		OutHit.FaceIndex = TriangleFaces[BestTriangle];
+		OutHit.Surface = TriangleSurfaces[BestTriangle];
+
+		return true;
+	}
+
+	bool FTriangleBVH::Raycast(const FVector& Origin, const FVector& End, FTriangleHit& OutHit) const
+	{
+		RaycastPacket(MakeArrayView(&Origin, 1), MakeArrayView(&End, 1), MakeArrayView(&OutHit, 1));
+		return OutHit.Triangle != -1;
+	}
+
+	void FTriangleBVH::RaycastPacket(const TConstArrayView<FVector> Origins, const TConstArrayView<FVector> Ends, const TArrayView<FTriangleHit> OutHits) const
+	{
+		const int32 NumRays = Origins.Num();
+		check(NumRays <= MaxPacketSize && Ends.Num() == NumRays && OutHits.Num() == NumRays)
+
+		FVector Deltas[MaxPacketSize];
+		FVector InvDeltas[MaxPacketSize];
+		double TMax[MaxPacketSize];
+		int32 BestTriangles[MaxPacketSize];
+
+		for (int r = 0; r < NumRays; r++)
+		{
+			const FVector Delta = Ends[r] - Origins[r];
+			Deltas[r] = Delta;
+			InvDeltas[r] = FVector(
+				Delta.X != 0 ? 1 / Delta.X : BIG_NUMBER,
+				Delta.Y != 0 ? 1 / Delta.Y : BIG_NUMBER,
+				Delta.Z != 0 ? 1 / Delta.Z : BIG_NUMBER);
+			TMax[r] = 1; // Segment parameter
+			BestTriangles[r] = -1;
+		}
+
+		// Slab test, clipped to the ray's current closest hit
+		auto RayBox = [&](const int32 r, const FBox& Box)
+		{
+			double T0 = 0;
+			double T1 = TMax[r];
+			for (int a = 0; a < 3; a++)
+			{
+				double TNear = (Box.Min[a] - Origins[r][a]) * InvDeltas[r][a];
+				double TFar = (Box.Max[a] - Origins[r][a]) * InvDeltas[r][a];
+				if (TNear > TFar) { Swap(TNear, TFar); }
+				T0 = FMath::Max(T0, TNear);
+				T1 = FMath::Min(T1, TFar);
+				if (T0 > T1) { return false; }
+			}
+			return true;
+		};
+
+		if (!Nodes.IsEmpty())
+		{
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				const FBVHNode& Node = Nodes[Stack.Pop(false)];
+#else
+				const FBVHNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+
+				int32 Active[MaxPacketSize];
+				int32 NumActive = 0;
+				for (int r = 0; r < NumRays; r++) { if (RayBox(r, Node.Bounds)) { Active[NumActive++] = r; } }
+
+				if (!NumActive) { continue; }
+
+				if (!Node.Count)
+				{
+					Stack.Add(Node.Start + 1);
+					Stack.Add(Node.Start);
+					continue;
+				}
+
+				for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const FIntVector3& T = Triangles[i];
+					const FVector& A = Vertices[T.X];
+					const FVector E1 = Vertices[T.Y] - A;
+					const FVector E2 = Vertices[T.Z] - A;
+
+					for (int k = 0; k < NumActive; k++)
+					{
+						// Möller-Trumbore, double-sided
+						const int32 r = Active[k];
+						const FVector P = FVector::CrossProduct(Deltas[r], E2);
+						const double Det = FVector::DotProduct(E1, P);
+						if (FMath::Abs(Det) < UE_DOUBLE_SMALL_NUMBER) { continue; }
+
+						const double InvDet = 1 / Det;
+						const FVector S = Origins[r] - A;
+						const double U = FVector::DotProduct(S, P) * InvDet;
+						if (U < 0 || U > 1) { continue; }
+
+						const FVector Q = FVector::CrossProduct(S, E1);
+						const double V = FVector::DotProduct(Deltas[r], Q) * InvDet;
+						if (V < 0 || U + V > 1) { continue; }
+
+						const double Time = FVector::DotProduct(E2, Q) * InvDet;
+						if (Time < 0 || Time > TMax[r]) { continue; }
+
+						TMax[r] = Time;
+						BestTriangles[r] = i;
+					}
+				}
+			}
+		}
+
+		for (int r = 0; r < NumRays; r++)
+		{
+			FTriangleHit& OutHit = OutHits[r];
+			const int32 Best = BestTriangles[r];
+
+			OutHit.Triangle = Best;
+			if (Best == -1) { continue; }
+
+			OutHit.Location = Origins[r] + Deltas[r] * TMax[r];
+			OutHit.Normal = GetTriangleNormal(Best);
+			OutHit.Distance = Deltas[r].Length() * TMax[r];
+			OutHit.FaceIndex = TriangleFaces[Best];
+			OutHit.Surface = TriangleSurfaces[Best];
+		}
+	}
+
+#pragma endregion
+}
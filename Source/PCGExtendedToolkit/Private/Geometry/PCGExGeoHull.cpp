@@ -0,0 +1,325 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoHull.h"
+
+#include "CompGeom/ConvexHull3.h"
+#include "CompGeom/ExactPredicates.h"
+
+namespace PCGExGeo
+{
+	namespace Hull
+	{
+		// Below this many points, hulls are computed in a single pass
+		constexpr int32 ChunkSize = 16384;
+
+		// Relative error bound of the 2D orientation determinant, see Shewchuk's ccwerrboundA
+		constexpr double Orient2DErrorBound = (3.0 + 16.0 * DBL_EPSILON * 0.5) * DBL_EPSILON * 0.5;
+
+		FORCEINLINE int32 GetChunkSize(const int32 NumPoints) { return FMath::Max(ChunkSize, FMath::DivideAndRoundUp(NumPoints, 64)); }
+
+		/**
+		 * Andrew's monotone chain over a subset of points.
+		 * InOutIndices is sorted in place, and replaced with the hull indices.
+		 * Collinear boundary points are kept as hull vertices, coincident points only once.
+		 * Returns false if the points are all collinear, in which case InOutIndices is left sorted.
+		 */
+		bool MonotoneChain(const TArrayView<const FVector2D>& Positions, TArray<int32>& InOutIndices)
+		{
+			if (InOutIndices.Num() < 3) { return false; }
+
+			InOutIndices.Sort(
+				[&](const int32 A, const int32 B)
+				{
+					const FVector2D& PA = Positions[A];
+					const FVector2D& PB = Positions[B];
+					return PA.X < PB.X || (PA.X == PB.X && PA.Y < PB.Y);
+				});
+
+			// Coincident points are adjacent once sorted
+			int32 NumPoints = 1;
+			for (int32 i = 1; i < InOutIndices.Num(); i++)
+			{
+				if (Positions[InOutIndices[i]] == Positions[InOutIndices[NumPoints - 1]]) { continue; }
+				InOutIndices[NumPoints++] = InOutIndices[i];
+			}
+			InOutIndices.SetNum(NumPoints);
+
+			if (NumPoints < 3) { return false; }
+
+			const FVector2D& First = Positions[InOutIndices[0]];
+			const FVector2D& Last = Positions[InOutIndices.Last()];
+
+			bool bCollinear = true;
+			for (int32 i = 1; i < NumPoints - 1; i++)
+			{
+				if (Orient2D(First, Last, Positions[InOutIndices[i]]) != 0)
+				{
+					bCollinear = false;
+					break;
+				}
+			}
+
+			if (bCollinear) { return false; }
+
+			TArray<int32> Chain;
+			Chain.SetNumUninitialized(NumPoints * 2);
+			int32 Num = 0;
+
+			// Only strict right turns are removed, so collinear boundary points stay on the chain
+
+			// Lower hull
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				const FVector2D& P = Positions[InOutIndices[i]];
+				while (Num >= 2 && Orient2D(Positions[InOutIndices[Chain[Num - 2]]], Positions[InOutIndices[Chain[Num - 1]]], P) < 0) { Num--; }
+				Chain[Num++] = i;
+			}
+
+			// Points along the max-X edge end up on the lower hull, they must not be walked again by the upper one
+			TBitArray<> OnLowerHull;
+			OnLowerHull.Init(false, NumPoints);
+			for (int32 i = 1; i < Num - 1; i++) { OnLowerHull[Chain[i]] = true; }
+
+			// Upper hull
+			const int32 LowerNum = Num + 1;
+			for (int32 i = NumPoints - 2; i >= 0; i--)
+			{
+				if (OnLowerHull[i]) { continue; }
+
+				const FVector2D& P = Positions[InOutIndices[i]];
+				while (Num >= LowerNum && Orient2D(Positions[InOutIndices[Chain[Num - 2]]], Positions[InOutIndices[Chain[Num - 1]]], P) < 0) { Num--; }
+				Chain[Num++] = i;
+			}
+
+			// Last point is the first one
+			Chain.SetNum(Num - 1);
+			for (int32& Index : Chain) { Index = InOutIndices[Index]; }
+			InOutIndices = MoveTemp(Chain);
+
+			return true;
+		}
+
+		/**
+		 * Cull points that are strictly inside the octagon formed by the extreme points along X, Y and both diagonals.
+		 */
+		void CullInterior(const TArrayView<const FVector2D>& Positions, TArray<int32>& OutCandidates)
+		{
+			const int32 NumPoints = Positions.Num();
+
+			// Extremes along X, Y, X+Y, X-Y, min then max
+			struct FExtremes
+			{
+				int32 Index[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+				double Value[8] = {MAX_dbl, MAX_dbl, MAX_dbl, MAX_dbl, -MAX_dbl, -MAX_dbl, -MAX_dbl, -MAX_dbl};
+
+				FORCEINLINE void Add(const int32 InIndex, const FVector2D& P)
+				{
+					const double Projections[4] = {P.X, P.Y, P.X + P.Y, P.X - P.Y};
+					for (int d = 0; d < 4; d++)
+					{
+						if (Projections[d] < Value[d]) { Value[d] = Projections[d]; Index[d] = InIndex; }
+						if (Projections[d] > Value[d + 4]) { Value[d + 4] = Projections[d]; Index[d + 4] = InIndex; }
+					}
+				}
+
+				FORCEINLINE void Merge(const FExtremes& Other)
+				{
+					for (int d = 0; d < 4; d++)
+					{
+						if (Other.Value[d] < Value[d]) { Value[d] = Other.Value[d]; Index[d] = Other.Index[d]; }
+						if (Other.Value[d + 4] > Value[d + 4]) { Value[d + 4] = Other.Value[d + 4]; Index[d + 4] = Other.Index[d + 4]; }
+					}
+				}
+			};
+
+			TArray<PCGExMT::FScope> Scopes;
+			const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGExMT::CompactionScopeSize);
+
+			TArray<FExtremes> ScopeExtremes;
+			ScopeExtremes.SetNum(NumScopes);
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					FExtremes& Extremes = ScopeExtremes[ScopeIndex];
+					const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+					for (int32 i = Scope.Start; i < Scope.End; i++) { Extremes.Add(i, Positions[i]); }
+				});
+
+			FExtremes Extremes;
+			for (const FExtremes& Other : ScopeExtremes) { Extremes.Merge(Other); }
+
+			// Counter-clockwise octagon : min Y, max X-Y, max X, max X+Y, max Y, min X-Y, min X, min X+Y
+			const int32 Octagon[8] = {Extremes.Index[1], Extremes.Index[7], Extremes.Index[4], Extremes.Index[6], Extremes.Index[5], Extremes.Index[3], Extremes.Index[0], Extremes.Index[2]};
+
+			TArray<FVector2D> Polygon;
+			Polygon.Reserve(8);
+			for (int32 i = 0; i < 8; i++)
+			{
+				const FVector2D& P = Positions[Octagon[i]];
+				if (Polygon.IsEmpty() || Polygon.Last() != P) { Polygon.Add(P); }
+			}
+
+			if (Polygon.Num() > 1 && Polygon.Last() == Polygon[0]) { Polygon.Pop(); }
+
+			if (Polygon.Num() < 3)
+			{
+				OutCandidates.SetNumUninitialized(NumPoints);
+				for (int32 i = 0; i < NumPoints; i++) { OutCandidates[i] = i; }
+				return;
+			}
+
+			// Interior test uses the filtered orientation, but only strict insiders are culled so its sign is all that matters
+			PCGExMT::GetCompactionIndices(
+				OutCandidates, NumPoints, [&](const int32 i)
+				{
+					const FVector2D& P = Positions[i];
+					for (int32 e = 0, NumEdges = Polygon.Num(); e < NumEdges; e++)
+					{
+						if (Orient2D(Polygon[e], Polygon[(e + 1) % NumEdges], P) <= 0) { return true; }
+					}
+					return false;
+				});
+		}
+	}
+
+	double Orient2D(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+	{
+		const double DetLeft = (B.X - A.X) * (C.Y - A.Y);
+		const double DetRight = (B.Y - A.Y) * (C.X - A.X);
+		const double Det = DetLeft - DetRight;
+
+		if (FMath::Abs(Det) > Hull::Orient2DErrorBound * (FMath::Abs(DetLeft) + FMath::Abs(DetRight))) { return Det; }
+
+		return UE::Geometry::ExactPredicates::Orient2<FVector2D>(A, B, C);
+	}
+
+	bool ConvexHull2D(const TArrayView<const FVector2D>& InPositions, TArray<int32>& OutHull)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::ConvexHull2D);
+
+		OutHull.Reset();
+		if (InPositions.Num() < 3) { return false; }
+
+		TArray<int32> Candidates;
+		Hull::CullInterior(InPositions, Candidates);
+
+		// Merge chunk hulls until everything fits in a single chunk
+
+		while (Candidates.Num() > Hull::ChunkSize)
+		{
+			TArray<PCGExMT::FScope> Scopes;
+			const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, Candidates.Num(), Hull::GetChunkSize(Candidates.Num()));
+
+			TArray<TArray<int32>> ChunkHulls;
+			ChunkHulls.SetNum(NumScopes);
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+					TArray<int32>& ChunkHull = ChunkHulls[ScopeIndex];
+					ChunkHull.Append(Candidates.GetData() + Scope.Start, Scope.Count);
+					Hull::MonotoneChain(InPositions, ChunkHull);
+				});
+
+			const int32 PreviousNum = Candidates.Num();
+			Candidates.Reset();
+			for (const TArray<int32>& ChunkHull : ChunkHulls) { Candidates.Append(ChunkHull); }
+
+			if (Candidates.Num() == PreviousNum) { break; } // Every point is on its chunk hull
+		}
+
+		if (!Hull::MonotoneChain(InPositions, Candidates) || Candidates.Num() < 3) { return false; }
+
+		OutHull = MoveTemp(Candidates);
+		return true;
+	}
+
+	bool ConvexHull3D(const TArrayView<const FVector>& InPositions, TArray<uint64>& OutEdges, TArray<int32>& OutHullVertices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::ConvexHull3D);
+
+		OutEdges.Reset();
+		OutHullVertices.Reset();
+
+		const int32 NumPoints = InPositions.Num();
+		if (NumPoints < 4) { return false; }
+
+		TArray<int32> Candidates;
+		Candidates.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Candidates[i] = i; }
+
+		auto SolveHull = [&](const TArrayView<const int32>& Indices, UE::Geometry::FConvexHull3d& OutSolver)
+		{
+			return OutSolver.Solve(Indices.Num(), [&](const int32 i) { return InPositions[Indices[i]]; });
+		};
+
+		// Only keep chunk hull vertices until everything fits in a single chunk
+
+		while (Candidates.Num() > Hull::ChunkSize)
+		{
+			TArray<PCGExMT::FScope> Scopes;
+			const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, Candidates.Num(), Hull::GetChunkSize(Candidates.Num()));
+
+			TArray<TArray<int32>> ChunkHulls;
+			ChunkHulls.SetNum(NumScopes);
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+					const TArrayView<const int32> ChunkIndices = MakeArrayView(Candidates.GetData() + Scope.Start, Scope.Count);
+					TArray<int32>& ChunkHull = ChunkHulls[ScopeIndex];
+
+					UE::Geometry::FConvexHull3d Solver;
+					if (!SolveHull(ChunkIndices, Solver))
+					{
+						// Degenerate chunk, keep all of it
+						ChunkHull.Append(ChunkIndices);
+						return;
+					}
+
+					TBitArray<> OnHull;
+					OnHull.Init(false, Scope.Count);
+					for (const UE::Geometry::FIndex3i& Triangle : Solver.GetTriangles()) { for (int t = 0; t < 3; t++) { OnHull[Triangle[t]] = true; } }
+					for (TConstSetBitIterator<> It(OnHull); It; ++It) { ChunkHull.Add(ChunkIndices[It.GetIndex()]); }
+				});
+
+			const int32 PreviousNum = Candidates.Num();
+			Candidates.Reset();
+			for (const TArray<int32>& ChunkHull : ChunkHulls) { Candidates.Append(ChunkHull); }
+
+			if (Candidates.Num() == PreviousNum) { break; } // Every point is on its chunk hull
+		}
+
+		UE::Geometry::FConvexHull3d Solver;
+		if (!SolveHull(Candidates, Solver)) { return false; }
+
+		const TArray<UE::Geometry::FIndex3i>& Triangles = Solver.GetTriangles();
+
+		TSet<uint64> UniqueEdges;
+		UniqueEdges.Reserve(Triangles.Num() * 3 / 2);
+
+		TSet<int32> HullVertices;
+		HullVertices.Reserve(Triangles.Num() / 2 + 2);
+
+		for (const UE::Geometry::FIndex3i& Triangle : Triangles)
+		{
+			for (int t = 0; t < 3; t++)
+			{
+				const int32 A = Candidates[Triangle[t]];
+				const int32 B = Candidates[Triangle[(t + 1) % 3]];
+				UniqueEdges.Add(PCGEx::H64U(A, B));
+				HullVertices.Add(A);
+			}
+		}
+
+		OutEdges = UniqueEdges.Array();
+		OutHullVertices = HullVertices.Array();
+		OutHullVertices.Sort();
+
+		return true;
+	}
+}
@@ -7,6 +7,9 @@
 #include "Data/PCGExPointIO.h"
 #include "PCGExGlobalSettings.h"
 #include "Graph/PCGExCluster.h"
+#include "Graph/PCGExGraph.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
 
 void UPCGExClusterNodesData::InitializeFromPCGExData(const UPCGExPointData* InPCGExPointData, const PCGExData::EIOInit InitMode)
 {
@@ -54,3 +57,171 @@ void UPCGExClusterEdgesData::BeginDestroy()
 	Super::BeginDestroy();
 	Cluster.Reset();
 }
+
+namespace PCGExClusterData
+{
+	constexpr int32 HashChunkSize = 4096;
+
+	static uint64 HashChunks(const int32 NumItems, const uint64 Seed, TFunctionRef<uint64(const int32, uint64)>&& HashItem)
+	{
+		// Hash fixed-size chunks in parallel, then fold them in order so the result doesn't depend on scheduling
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumItems, HashChunkSize);
+		TArray<uint64> ChunkHashes;
+		ChunkHashes.SetNumZeroed(NumChunks);
+
+		PCGExMT::ParallelForBlocking(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 Start = ChunkIndex * HashChunkSize;
+				const int32 End = FMath::Min(Start + HashChunkSize, NumItems);
+				uint64 H = ChunkIndex;
+				for (int i = Start; i < End; i++) { H = HashItem(i, H); }
+				ChunkHashes[ChunkIndex] = H;
+			}, NumChunks <= 1);
+
+		return CityHash64WithSeed(reinterpret_cast<const char*>(ChunkHashes.GetData()), ChunkHashes.Num() * sizeof(uint64), Seed ^ NumItems);
+	}
+
+	uint64 ComputeVtxContentHash(const TSharedRef<PCGExData::FPointIO>& VtxIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::ComputeVtxContentHash);
+
+		const UPCGPointData* InData = VtxIO->GetIn();
+		if (!InData) { return 0; }
+
+		const FPCGMetadataAttribute<int64>* VtxIdxAttribute = InData->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Attr_PCGExVtxIdx);
+		if (!VtxIdxAttribute) { return 0; }
+
+		const TArray<FPCGPoint>& InPoints = InData->GetPoints();
+
+		return HashChunks(
+			InPoints.Num(), 0x5654, [&](const int32 Index, const uint64 H)
+			{
+				const FPCGPoint& Point = InPoints[Index];
+				struct
+				{
+					FVector Location;
+					int64 VtxIdx;
+				} Item{Point.Transform.GetLocation(), VtxIdxAttribute->GetValueFromItemKey(Point.MetadataEntry)};
+				return CityHash64WithSeed(reinterpret_cast<const char*>(&Item), sizeof(Item), H);
+			});
+	}
+
+	uint64 ComputeEdgesContentHash(const TSharedRef<PCGExData::FPointIO>& EdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::ComputeEdgesContentHash);
+
+		const UPCGPointData* InData = EdgesIO->GetIn();
+		if (!InData) { return 0; }
+
+		const FPCGMetadataAttribute<int64>* EdgeIdxAttribute = InData->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Attr_PCGExEdgeIdx);
+		if (!EdgeIdxAttribute) { return 0; }
+
+		const TArray<FPCGPoint>& InPoints = InData->GetPoints();
+
+		const uint64 EdgesHash = HashChunks(
+			InPoints.Num(), 0x4544, [&](const int32 Index, const uint64 H)
+			{
+				const int64 Endpoints = EdgeIdxAttribute->GetValueFromItemKey(InPoints[Index].MetadataEntry);
+				return CityHash64WithSeed(reinterpret_cast<const char*>(&Endpoints), sizeof(int64), H);
+			});
+
+		return EdgesHash ? EdgesHash : 1;
+	}
+
+	FClusterCache& FClusterCache::Get()
+	{
+		static FClusterCache Instance;
+		return Instance;
+	}
+
+	uint64 FClusterCache::MakeKey(const uint64 VtxHash, const uint64 EdgesHash)
+	{
+		return CityHash128to64(Uint128_64(VtxHash, EdgesHash));
+	}
+
+	FBox FClusterCache::GetVtxBounds(const TSharedRef<PCGExData::FPointIO>& VtxIO)
+	{
+		const UPCGPointData* InData = VtxIO->GetIn();
+		return InData ? InData->GetBounds() : FBox(ForceInit);
+	}
+
+	TSharedPtr<PCGExCluster::FCluster> FClusterCache::Find(const uint64 VtxHash, const uint64 EdgesHash, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO)
+	{
+		if (!VtxHash || !EdgesHash) { return nullptr; }
+
+		const uint64 Key = MakeKey(VtxHash, EdgesHash);
+
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		FEntry* Entry = Entries.Find(Key);
+		if (!Entry) { return nullptr; }
+
+		if (Entry->VtxHash != VtxHash || Entry->EdgesHash != EdgesHash ||
+			Entry->VtxBounds != GetVtxBounds(VtxIO) ||
+			!Entry->Cluster->IsValidWith(VtxIO, EdgeIO))
+		{
+			// Hash collision or stale entry
+			TotalSize -= Entry->Size;
+			Entries.Remove(Key);
+			return nullptr;
+		}
+
+		Entry->LastAccess = ++AccessCounter;
+		return Entry->Cluster;
+	}
+
+	void FClusterCache::Add(const uint64 VtxHash, const uint64 EdgesHash, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedPtr<PCGExCluster::FCluster>& InCluster)
+	{
+		if (!VtxHash || !EdgesHash || !InCluster) { return; }
+
+		int64 Size = InCluster->Nodes->GetAllocatedSize() + InCluster->Edges->GetAllocatedSize() + InCluster->NodePositions.GetAllocatedSize();
+		for (const PCGExCluster::FNode& Node : *InCluster->Nodes) { Size += Node.Links.GetAllocatedSize(); }
+
+		const int64 Budget = GetDefault<UPCGExGlobalSettings>()->GetPersistentClusterCacheBudget();
+		if (Size > Budget) { return; }
+
+		const uint64 Key = MakeKey(VtxHash, EdgesHash);
+		const FBox VtxBounds = GetVtxBounds(VtxIO);
+
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		if (const FEntry* Existing = Entries.Find(Key)) { TotalSize -= Existing->Size; }
+
+		FEntry& Entry = Entries.Add(Key);
+		Entry.Cluster = InCluster;
+		Entry.VtxHash = VtxHash;
+		Entry.EdgesHash = EdgesHash;
+		Entry.VtxBounds = VtxBounds;
+		Entry.Size = Size;
+		Entry.LastAccess = ++AccessCounter;
+
+		TotalSize += Size;
+
+		EnforceBudget_Unsafe(Budget);
+	}
+
+	void FClusterCache::Flush()
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+		Entries.Empty();
+		TotalSize = 0;
+	}
+
+	void FClusterCache::EnforceBudget_Unsafe(const int64 Budget)
+	{
+		if (TotalSize <= Budget) { return; }
+
+		TArray<TPair<uint64, uint64>> Candidates; // LastAccess, Key
+		Candidates.Reserve(Entries.Num());
+		for (const TPair<uint64, FEntry>& Pair : Entries) { Candidates.Emplace(Pair.Value.LastAccess, Pair.Key); }
+		Candidates.Sort([](const TPair<uint64, uint64>& A, const TPair<uint64, uint64>& B) { return A.Key < B.Key; });
+
+		for (const TPair<uint64, uint64>& Candidate : Candidates)
+		{
+			if (TotalSize <= Budget) { break; }
+			TotalSize -= Entries[Candidate.Value].Size;
+			Entries.Remove(Candidate.Value);
+		}
+	}
+}
@@ -4,7 +4,7 @@
 #include "Graph/Diagrams/PCGExBuildConvexHull.h"
 
 #include "Elements/Metadata/PCGMetadataElementCommon.h"
-#include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 #include "Graph/PCGExCluster.h"
 
 #define LOCTEXT_NAMESPACE "PCGExGraph"
@@ -75,14 +75,14 @@ namespace PCGExConvexHull
 
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
-		// Build delaunay
+		// Build hull
 
 		TArray<FVector> ActivePositions;
 		PCGExGeo::PointsToPositions(PointDataFacade->GetIn()->GetPoints(), ActivePositions);
 
-		Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
-
-		if (!Delaunay->Process<false, true>(ActivePositions))
+		TArray<uint64> Edges;
+		TArray<int32> Hull;
+		if (!PCGExGeo::ConvexHull3D(ActivePositions, Edges, Hull))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generates no results. Are points coplanar? If so, use Convex Hull 2D instead."));
 			return false;
@@ -91,33 +91,16 @@ namespace PCGExConvexHull
 		ActivePositions.Empty();
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-		Edges = Delaunay->DelaunayEdges.Array();
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
-		StartParallelLoopForRange(Edges.Num());
-
-		return true;
-	}
-
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
-	{
-		PCGExGraph::FEdge E;
-		const uint64 Edge = Edges[Iteration];
 
-		uint32 A;
-		uint32 B;
-		PCGEx::H64(Edge, A, B);
-		const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-		const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+		TArray<PCGExGraph::FNode>& Nodes = GraphBuilder->Graph->Nodes;
+		for (PCGExGraph::FNode& Node : Nodes) { Node.bValid = false; }
+		for (const int32 Index : Hull) { Nodes[Index].bValid = true; }
 
-		if (!bAIsOnHull || !bBIsOnHull)
-		{
-			if (!bAIsOnHull) { GraphBuilder->Graph->Nodes[A].bValid = false; }
-			if (!bBIsOnHull) { GraphBuilder->Graph->Nodes[B].bValid = false; }
-			return;
-		}
+		GraphBuilder->Graph->InsertEdges(Edges, -1);
 
-		GraphBuilder->Graph->InsertEdge(A, B, E);
+		return true;
 	}
 
 	void FProcessor::CompleteWork()
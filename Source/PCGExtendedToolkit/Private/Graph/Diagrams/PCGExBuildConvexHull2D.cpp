@@ -5,7 +5,7 @@
 
 
 #include "Elements/Metadata/PCGMetadataElementCommon.h"
-#include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 #include "Graph/PCGExCluster.h"
 
 #define LOCTEXT_NAMESPACE "PCGExGraph"
@@ -135,16 +135,19 @@ namespace PCGExConvexHull2D
 		ProjectionDetails = Settings->ProjectionDetails;
 		ProjectionDetails.Init(ExecutionContext, PointDataFacade);
 
-		// Build delaunay
+		// Build hull
 
-		TArray<FVector> ActivePositions;
-		PCGExGeo::PointsToPositions(PointDataFacade->Source->GetIn()->GetPoints(), ActivePositions);
-
-		Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+		TArray<FVector2D> ActivePositions;
+		{
+			TArray<FVector> Positions;
+			PCGExGeo::PointsToPositions(PointDataFacade->Source->GetIn()->GetPoints(), Positions);
+			ProjectionDetails.Project(Positions, ActivePositions);
+		}
 
-		if (!Delaunay->Process(ActivePositions, ProjectionDetails))
+		TArray<int32> Hull;
+		if (!PCGExGeo::ConvexHull2D(ActivePositions, Hull))
 		{
-			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generates no results. Are points coplanar? If so, use Convex Hull 2D instead."));
+			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generates no results. Are points colinear?"));
 			return false;
 		}
 
@@ -152,33 +155,19 @@ namespace PCGExConvexHull2D
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
 
-		Edges = Delaunay->DelaunayEdges.Array();
+		TArray<uint64> Edges;
+		Edges.SetNumUninitialized(Hull.Num());
+		for (int i = 0; i < Hull.Num(); i++) { Edges[i] = PCGEx::H64U(Hull[i], Hull[(i + 1) % Hull.Num()]); }
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
-		StartParallelLoopForRange(Edges.Num());
-
-		return true;
-	}
 
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
-	{
-		PCGExGraph::FEdge E;
-		const uint64 Edge = Edges[Iteration];
-
-		uint32 A;
-		uint32 B;
-		PCGEx::H64(Edge, A, B);
-		const bool bAIsOnHull = Delaunay->DelaunayHull.Contains(A);
-		const bool bBIsOnHull = Delaunay->DelaunayHull.Contains(B);
+		TArray<PCGExGraph::FNode>& Nodes = GraphBuilder->Graph->Nodes;
+		for (PCGExGraph::FNode& Node : Nodes) { Node.bValid = false; }
+		for (const int32 Index : Hull) { Nodes[Index].bValid = true; }
 
-		if (!bAIsOnHull || !bBIsOnHull)
-		{
-			if (!bAIsOnHull) { GraphBuilder->Graph->Nodes[A].bValid = false; }
-			if (!bBIsOnHull) { GraphBuilder->Graph->Nodes[B].bValid = false; }
-			return;
-		}
+		GraphBuilder->Graph->InsertEdges(Edges, -1);
 
-		GraphBuilder->Graph->InsertEdge(A, B, E);
+		return true;
 	}
 
 	void FProcessor::CompleteWork()
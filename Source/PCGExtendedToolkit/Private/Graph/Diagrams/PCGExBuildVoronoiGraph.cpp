@@ -134,36 +134,47 @@ namespace PCGExBuildVoronoi
 			TArray<FPCGPoint>& Centroids = PointDataFacade->GetOut()->GetMutablePoints();
 
 			const int32 NumSites = Voronoi->Centroids.Num();
+
+			// Kept sites are laid out through a prefix sum over in-bounds flags, so both passes can run in parallel
+			TArray<int32> KeptSites;
+			const int32 NumKept = PCGExMT::GetCompactionIndices(KeptSites, NumSites, [&](const int32 i) { return Bounds.IsInside(Voronoi->Circumspheres[i].Center); });
+
 			TArray<int32> RemappedIndices;
-			RemappedIndices.SetNumUninitialized(NumSites);
-			Centroids.Reserve(NumSites);
+			RemappedIndices.Init(-1, NumSites);
+			Centroids.SetNum(NumKept);
 
-			for (int i = 0; i < NumSites; i++)
-			{
-				const FVector Centroid = Voronoi->Circumspheres[i].Center;
-				if (!Bounds.IsInside(Centroid))
+			PCGExMT::ParallelForBlocking(
+				NumKept, [&](const int32 i)
 				{
-					RemappedIndices[i] = -1;
-					continue;
-				}
-
-				RemappedIndices[i] = Centroids.Num();
-				FPCGPoint& NewPoint = Centroids.Emplace_GetRef();
-				NewPoint.Transform.SetLocation(Centroid);
-				NewPoint.Seed = PCGExRandom::ComputeSeed(NewPoint);
-			}
+					const int32 SiteIndex = KeptSites[i];
+					RemappedIndices[SiteIndex] = i;
+					FPCGPoint& NewPoint = Centroids[i];
+					NewPoint.Transform.SetLocation(Voronoi->Circumspheres[SiteIndex].Center);
+					NewPoint.Seed = PCGExRandom::ComputeSeed(NewPoint);
+				});
+
+			KeptSites.Empty();
+
+			TArray<uint64>& VoronoiEdges = Voronoi->VoronoiEdges;
+			TArray<int32> KeptEdges;
+			const int32 NumKeptEdges = PCGExMT::GetCompactionIndices(
+				KeptEdges, VoronoiEdges.Num(), [&](const int32 i)
+				{
+					const uint64 Hash = VoronoiEdges[i];
+					return RemappedIndices[PCGEx::H64A(Hash)] != -1 && RemappedIndices[PCGEx::H64B(Hash)] != -1;
+				});
 
 			TArray<uint64> ValidEdges;
-			ValidEdges.Reserve(Voronoi->VoronoiEdges.Num());
+			ValidEdges.SetNumUninitialized(NumKeptEdges);
 
-			for (const uint64 Hash : Voronoi->VoronoiEdges)
-			{
-				const int32 A = RemappedIndices[PCGEx::H64A(Hash)];
-				const int32 B = RemappedIndices[PCGEx::H64B(Hash)];
-				if (A == -1 || B == -1) { continue; }
-				ValidEdges.Add(PCGEx::H64(A, B));
-			}
+			PCGExMT::ParallelForBlocking(
+				NumKeptEdges, [&](const int32 i)
+				{
+					const uint64 Hash = VoronoiEdges[KeptEdges[i]];
+					ValidEdges[i] = PCGEx::H64(RemappedIndices[PCGEx::H64A(Hash)], RemappedIndices[PCGEx::H64B(Hash)]);
+				});
 
+			KeptEdges.Empty();
 			RemappedIndices.Empty();
 			//ExtractValidSites();
 			Voronoi.Reset();
@@ -179,32 +190,30 @@ namespace PCGExBuildVoronoi
 			const int32 NumSites = Voronoi->Centroids.Num();
 			Centroids.SetNum(NumSites);
 
-			if (Settings->Method == EPCGExCellCenter::Circumcenter)
-			{
-				for (int i = 0; i < NumSites; i++)
-				{
-					Centroids[i].Transform.SetLocation(Voronoi->Circumspheres[i].Center);
-					Centroids[i].Seed = PCGExRandom::ComputeSeed(Centroids[i]);
-				}
-			}
-			else if (Settings->Method == EPCGExCellCenter::Centroid)
-			{
-				for (int i = 0; i < NumSites; i++)
-				{
-					Centroids[i].Transform.SetLocation(Voronoi->Centroids[i]);
-					Centroids[i].Seed = PCGExRandom::ComputeSeed(Centroids[i]);
-				}
-			}
-			else if (Settings->Method == EPCGExCellCenter::Balanced)
-			{
-				for (int i = 0; i < NumSites; i++)
+			const EPCGExCellCenter Method = Settings->Method;
+
+			PCGExMT::ParallelForBlocking(
+				NumSites, [&](const int32 i)
 				{
-					FVector Target = Voronoi->Circumspheres[i].Center;
-					if (Bounds.IsInside(Target)) { Centroids[i].Transform.SetLocation(Target); }
-					else { Centroids[i].Transform.SetLocation(Voronoi->Centroids[i]); }
-					Centroids[i].Seed = PCGExRandom::ComputeSeed(Centroids[i]);
-				}
-			}
+					FPCGPoint& Centroid = Centroids[i];
+
+					if (Method == EPCGExCellCenter::Circumcenter)
+					{
+						Centroid.Transform.SetLocation(Voronoi->Circumspheres[i].Center);
+					}
+					else if (Method == EPCGExCellCenter::Centroid)
+					{
+						Centroid.Transform.SetLocation(Voronoi->Centroids[i]);
+					}
+					else if (Method == EPCGExCellCenter::Balanced)
+					{
+						const FVector Target = Voronoi->Circumspheres[i].Center;
+						if (Bounds.IsInside(Target)) { Centroid.Transform.SetLocation(Target); }
+						else { Centroid.Transform.SetLocation(Voronoi->Centroids[i]); }
+					}
+
+					Centroid.Seed = PCGExRandom::ComputeSeed(Centroid);
+				});
 
 			GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 			GraphBuilder->Graph->InsertEdges(Voronoi->VoronoiEdges, -1);
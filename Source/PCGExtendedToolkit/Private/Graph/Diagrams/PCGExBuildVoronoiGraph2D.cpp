@@ -359,11 +359,8 @@ namespace PCGExBuildVoronoi2D
 			if (!Settings->bPruneOpenSites) { SiteDataFacade->Write(AsyncManager); }
 			else
 			{
-				TArray<FPCGPoint>& MutablePoints = SiteDataFacade->GetOut()->GetMutablePoints();
-				int32 WriteIndex = 0;
-				for (int32 i = 0; i < MutablePoints.Num(); i++) { if (IsVtxValid[i]) { MutablePoints[WriteIndex++] = MutablePoints[i]; } }
-
-				MutablePoints.SetNum(WriteIndex);
+				const TBitArray<>& ValidSites = IsVtxValid;
+				PCGExMT::Compact(SiteDataFacade->GetOut()->GetMutablePoints(), [&](const int32 Index) { return ValidSites[Index]; });
 			}
 		}
 
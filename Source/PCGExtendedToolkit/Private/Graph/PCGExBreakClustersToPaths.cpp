@@ -108,17 +108,17 @@ namespace PCGExBreakClustersToPaths
 
 	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
 	{
-		const TSharedPtr<PCGExCluster::FNodeChain> Chain = ChainBuilder->Chains[Iteration];
-		if (!Chain) { return; }
+		const PCGExCluster::FNodeChain& Chain = ChainBuilder->Chains[Iteration];
+		const TConstArrayView<PCGExGraph::FLink> Links = ChainBuilder->GetLinks(Chain);
 
-		if (Settings->LeavesHandling == EPCGExBreakClusterLeavesHandling::Exclude && Chain->bIsLeaf) { return; }
+		if (Settings->LeavesHandling == EPCGExBreakClusterLeavesHandling::Exclude && Chain.bIsLeaf) { return; }
 
-		const int32 ChainSize = Chain->Links.Num() + 1;
+		const int32 ChainSize = Links.Num() + 1;
 
 		if (ChainSize < Settings->MinPointCount) { return; }
 		if (Settings->bOmitAbovePointCount && ChainSize > Settings->MaxPointCount) { return; }
 
-		PCGExGraph::FEdge ChainDir = PCGExGraph::FEdge(Chain->Seed.Edge, Cluster->GetNode(Chain->Seed)->PointIndex, Cluster->GetNode(Chain->Links.Last())->PointIndex);
+		PCGExGraph::FEdge ChainDir = PCGExGraph::FEdge(Chain.Seed.Edge, Cluster->GetNode(Chain.Seed)->PointIndex, Cluster->GetNode(Links.Last())->PointIndex);
 		const bool bReverse = DirectionSettings.SortEndpoints(Cluster.Get(), ChainDir);
 
 		const TSharedPtr<PCGExData::FPointIO> PathIO = Context->Paths->Emplace_GetRef<UPCGPointData>(VtxDataFacade->Source, PCGExData::EIOInit::New);
@@ -129,10 +129,10 @@ namespace PCGExBreakClustersToPaths
 
 		int32 PtIndex = 0;
 
-		MutablePoints[PtIndex++] = PathIO->GetInPoint(Cluster->GetNode(Chain->Seed)->PointIndex);
-		for (const PCGExGraph::FLink& Lk : Chain->Links) { MutablePoints[PtIndex++] = PathIO->GetInPoint(Cluster->GetNode(Lk)->PointIndex); }
+		MutablePoints[PtIndex++] = PathIO->GetInPoint(Cluster->GetNode(Chain.Seed)->PointIndex);
+		for (const PCGExGraph::FLink& Lk : Links) { MutablePoints[PtIndex++] = PathIO->GetInPoint(Cluster->GetNode(Lk)->PointIndex); }
 
-		if (!Chain->bIsClosedLoop) { if (Settings->bTagIfOpenPath) { PathIO->Tags->AddRaw(Settings->IsOpenPathTag); } }
+		if (!Chain.bIsClosedLoop) { if (Settings->bTagIfOpenPath) { PathIO->Tags->AddRaw(Settings->IsOpenPathTag); } }
 		else { if (Settings->bTagIfClosedLoop) { PathIO->Tags->AddRaw(Settings->IsClosedLoopTag); } }
 
 		if (bReverse) { Algo::Reverse(MutablePoints); }
@@ -141,13 +141,13 @@ namespace PCGExBreakClustersToPaths
 		{
 			// TODO : Reverse once only
 
-			if (!Settings->bWindOnlyClosedLoops || Chain->bIsClosedLoop)
+			if (!Settings->bWindOnlyClosedLoops || Chain.bIsClosedLoop)
 			{
 				const TArray<FVector2D>& PP = *ProjectedPositions;
 				TArray<FVector2D> WindingPoints;
 				PCGEx::InitArray(WindingPoints, PtIndex);
-				WindingPoints[0] = PP[Cluster->GetNode(Chain->Seed)->PointIndex];
-				for (int i = 0; i < PtIndex; i++) { WindingPoints[i + 1] = PP[Cluster->GetNode(Chain->Links[i])->PointIndex]; }
+				WindingPoints[0] = PP[Cluster->GetNode(Chain.Seed)->PointIndex];
+				for (int i = 0; i < Links.Num(); i++) { WindingPoints[i + 1] = PP[Cluster->GetNode(Links[i])->PointIndex]; }
 
 				if (!PCGExGeo::IsWinded(Settings->Winding, UE::Geometry::CurveUtil::SignedArea2<double, FVector2D>(WindingPoints) < 0)
 					&& !bReverse)
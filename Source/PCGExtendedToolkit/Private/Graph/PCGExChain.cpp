@@ -6,86 +6,27 @@
 
 namespace PCGExCluster
 {
-	void FNodeChain::FixUniqueHash()
-	{
-		UniqueHash = 0;
-		SingleEdge = -1;
-
-		if (Links.Num() <= 1) { SingleEdge = Seed.Edge; }
-
-		if (SingleEdge != -1) { UniqueHash = PCGEx::H64U(SingleEdge, SingleEdge); }
-		else { UniqueHash = PCGEx::H64U(bIsClosedLoop ? Seed.Edge : Links[0].Edge, Links.Last().Edge); }
-	}
-
-	void FNodeChain::BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints)
-	{
-		ON_SCOPE_EXIT
-		{
-			FixUniqueHash();
-			bIsLeaf = Cluster->GetNode(Seed.Node)->IsLeaf() || Cluster->GetNode(Links.Last().Node)->IsLeaf();
-			if (bIsClosedLoop) { bIsLeaf = false; }
-		};
-
-		TSet<int32> Visited;
-
-		FLink Last = Seed;
-		FNode* FromNode = Cluster->GetEdgeOtherNode(Seed);
-		Links.Add(FLink(FromNode->Index, Seed.Edge));
-
-		Visited.Add(Seed.Node);
-		Visited.Add(Links.Last().Node);
-
-		while (FromNode)
-		{
-			if (FromNode->IsLeaf() ||
-				FromNode->IsComplex() ||
-				(Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
-			{
-				bIsClosedLoop = false;
-				break;
-			}
-
-			FLink NextLink = FromNode->Links[0];                               // Get next node
-			if (NextLink.Node == Last.Node) { NextLink = FromNode->Links[1]; } // Get other next
-
-			bool bAlreadyVisited = false;
-			Visited.Add(NextLink.Node, &bAlreadyVisited);
-
-			if (bAlreadyVisited || NextLink.Node == Seed.Node)
-			{
-				Seed.Edge = NextLink.Edge; // !
-				bIsClosedLoop = true;
-				break;
-			}
-
-			Last = Links.Last();
-			Links.Add(NextLink);
-
-			FromNode = Cluster->GetNode(NextLink.Node);
-		}
-	}
-
-	void FNodeChain::Dump(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const
+	void FNodeChainBuilder::Dump(const FNodeChain& Chain, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const
 	{
 		const int32 IOIndex = Cluster->EdgesIO.Pin()->IOIndex;
 		FEdge OutEdge = FEdge{};
 
-		if (SingleEdge != -1)
+		if (Chain.SingleEdge != -1)
 		{
-			Graph->InsertEdge(*Cluster->GetEdge(Seed.Edge), OutEdge, IOIndex);
+			Graph->InsertEdge(*Cluster->GetEdge(Chain.Seed.Edge), OutEdge, IOIndex);
 			if (bAddMetadata) { Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = 1; }
 		}
 		else
 		{
 			if (bAddMetadata)
 			{
-				if (bIsClosedLoop)
+				if (Chain.bIsClosedLoop)
 				{
-					Graph->InsertEdge(*Cluster->GetEdge(Seed.Edge), OutEdge, IOIndex);
+					Graph->InsertEdge(*Cluster->GetEdge(Chain.Seed.Edge), OutEdge, IOIndex);
 					Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = 1;
 				}
 
-				for (const FLink& Link : Links)
+				for (const FLink& Link : GetLinks(Chain))
 				{
 					Graph->InsertEdge(*Cluster->GetEdge(Link.Edge), OutEdge, IOIndex);
 					Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = 1;
@@ -93,135 +34,243 @@ namespace PCGExCluster
 			}
 			else
 			{
-				if (bIsClosedLoop) { Graph->InsertEdge(*Cluster->GetEdge(Seed.Edge), OutEdge, IOIndex); }
-				for (const FLink& Link : Links) { Graph->InsertEdge(*Cluster->GetEdge(Link.Edge), OutEdge, IOIndex); }
+				if (Chain.bIsClosedLoop) { Graph->InsertEdge(*Cluster->GetEdge(Chain.Seed.Edge), OutEdge, IOIndex); }
+				for (const FLink& Link : GetLinks(Chain)) { Graph->InsertEdge(*Cluster->GetEdge(Link.Edge), OutEdge, IOIndex); }
 			}
 		}
 	}
 
-	void FNodeChain::DumpReduced(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const
+	void FNodeChainBuilder::DumpReduced(const FNodeChain& Chain, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const
 	{
 		const int32 IOIndex = Cluster->EdgesIO.Pin()->IOIndex;
 		FEdge OutEdge = FEdge{};
 
-		if (SingleEdge != -1)
+		if (Chain.SingleEdge != -1)
 		{
-			Graph->InsertEdge(*Cluster->GetEdge(SingleEdge), OutEdge, IOIndex);
+			Graph->InsertEdge(*Cluster->GetEdge(Chain.SingleEdge), OutEdge, IOIndex);
 			if (bAddMetadata) { Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = 1; }
 		}
 		else
 		{
-			if (bAddMetadata)
-			{
-				Graph->InsertEdge(
-					Cluster->GetNode(Seed)->PointIndex,
-					Cluster->GetNode(Links.Last())->PointIndex,
-					OutEdge, IOIndex);
+			Graph->InsertEdge(
+				Cluster->GetNode(Chain.Seed)->PointIndex,
+				Cluster->GetNode(GetLastLink(Chain))->PointIndex,
+				OutEdge, IOIndex);
 
-				Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = Links.Num();
-			}
-			else
-			{
-				Graph->InsertEdge(
-					Cluster->GetNode(Seed)->PointIndex,
-					Cluster->GetNode(Links.Last())->PointIndex,
-					OutEdge, IOIndex);
-			}
+			if (bAddMetadata) { Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = Chain.NumLinks; }
 		}
 	}
 
 	bool FNodeChainBuilder::Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		Chains.Reserve(Cluster->Edges->Num());
+		SeedOffsets.Init(-1, Cluster->Nodes->Num());
+		Seeds.Reserve(Cluster->Edges->Num());
 
 		for (int i = 0; i < Cluster->Nodes->Num(); i++)
 		{
-			FNode* Node = Cluster->GetNode(i);
+			const FNode* Node = Cluster->GetNode(i);
 			ensure(!Node->IsEmpty());
 
 			if (Node->IsEmpty()) { continue; }
-			if (Node->IsLeaf())
-			{
-				PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
-				Chains.Add(NewChain);
-				continue;
-			}
+			if (Node->IsBinary() && !(Breakpoints && (*Breakpoints)[Node->PointIndex])) { continue; }
 
-			if (Node->IsBinary()) { continue; }
-			if (Breakpoints && !(*Breakpoints)[Node->PointIndex])
-
-			{
-				for (const FLink& Lk : Node->Links)
-				{
-					// Skip immediately known leaves or already seeded nodes. Avoid double-sampling simple cases
-					if (Cluster->GetNode(Lk.Node)->IsLeaf()) { continue; }
-
-					PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Lk.Edge))
-					Chains.Add(NewChain);
-				}
-			}
+			AddSeeds(Node, false);
 		}
 
-		Chains.Shrink();
-		if (Chains.IsEmpty()) { return false; }
+		if (Seeds.IsEmpty()) { return false; }
 		return DispatchTasks(AsyncManager);
 	}
 
 	bool FNodeChainBuilder::CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		Chains.Reserve(Cluster->Edges->Num());
+		SeedOffsets.Init(-1, Cluster->Nodes->Num());
+		Seeds.Reserve(Cluster->Edges->Num());
 
 		for (int i = 0; i < Cluster->Nodes->Num(); i++)
 		{
-			FNode* Node = Cluster->GetNode(i);
+			const FNode* Node = Cluster->GetNode(i);
 			ensure(!Node->IsEmpty());
 			if (!Node->IsLeaf() || Node->IsEmpty()) { continue; }
 
-			PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
-			Chains.Add(NewChain);
+			AddSeeds(Node, true);
 		}
 
-		Chains.Shrink();
-		if (Chains.IsEmpty()) { return false; }
+		if (Seeds.IsEmpty()) { return false; }
 		return DispatchTasks(AsyncManager);
 	}
 
+	void FNodeChainBuilder::AddSeeds(const FNode* Node, const bool bLeavesOnly)
+	{
+		SeedOffsets[Node->Index] = Seeds.Num();
+		if (bLeavesOnly) { Seeds.Emplace(Node->Index, Node->Links[0].Edge); }
+		else { for (const FLink& Lk : Node->Links) { Seeds.Emplace(Node->Index, Lk.Edge); } }
+	}
+
+	int32 FNodeChainBuilder::GetSeedIndex(const int32 NodeIndex, const int32 EdgeIndex) const
+	{
+		const int32 Offset = SeedOffsets[NodeIndex];
+		if (Offset == -1) { return -1; }
+
+		const TArray<FLink>& NodeLinks = Cluster->GetNode(NodeIndex)->Links;
+		for (int i = 0; i < NodeLinks.Num(); i++) { if (NodeLinks[i].Edge == EdgeIndex) { return Offset + i; } }
+
+		return -1;
+	}
+
 	bool FNodeChainBuilder::DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
+		EdgeOwners.Init(-1, Cluster->Edges->Num());
+		Walks.SetNum(Seeds.Num());
+
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ChainSearchTask)
 
 		ChainSearchTask->OnCompleteCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
-				This->Dedupe();
+				This->Gather();
+			};
+
+		ChainSearchTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopeLinks.SetNum(Loops.Num());
 			};
 
-		ChainSearchTask->OnIterationCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]
-			(const int32 Index, const PCGExMT::FScope& Scope)
+		ChainSearchTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints);
+				for (int i = Scope.Start; i < Scope.End; i++) { This->WalkChain(i, Scope.LoopIndex); }
 			};
 
-		ChainSearchTask->StartIterations(Chains.Num(), 64, false);
+		ChainSearchTask->StartSubLoops(Seeds.Num(), 256);
 		return true;
 	}
 
-	void FNodeChainBuilder::Dedupe()
+	void FNodeChainBuilder::WalkChain(const int32 SeedIndex, const int32 ScopeIndex)
 	{
-		TSet<uint64> UniqueHashSet;
-		UniqueHashSet.Reserve(Chains.Num());
+		const FLink Seed = Seeds[SeedIndex];
+
+		// Claim the first edge; if it's already owned, the chain has been (or is being) walked from its other end
+		if (FPlatformAtomics::InterlockedCompareExchange(&EdgeOwners[Seed.Edge], SeedIndex, -1) != -1) { return; }
+
+		TArray<FLink>& OutLinks = ScopeLinks[ScopeIndex];
+		const int32 LinksStart = OutLinks.Num();
+
+		FNodeChain Chain(Seed);
+
+		FLink Last = Seed;
+		const FNode* FromNode = Cluster->GetEdgeOtherNode(Seed);
+		OutLinks.Emplace(FromNode->Index, Seed.Edge);
+
+		// Only binary nodes are walked through, so the walk can only loop back onto its seed
+		while (!FromNode->IsLeaf() && !FromNode->IsComplex() && !(Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
+		{
+			FLink NextLink = FromNode->Links[0];                               // Get next node
+			if (NextLink.Node == Last.Node) { NextLink = FromNode->Links[1]; } // Get other next
+
+			if (NextLink.Node == Seed.Node)
+			{
+				Chain.Seed.Edge = NextLink.Edge; // !
+				Chain.bIsClosedLoop = true;
+				break;
+			}
+
+			Last = OutLinks.Last();
+			OutLinks.Add(NextLink);
+
+			FromNode = Cluster->GetNode(NextLink.Node);
+		}
+
+		const FLink& LastLink = OutLinks.Last();
+		const int32 EndNode = Chain.bIsClosedLoop ? Seed.Node : LastLink.Node;
+		const int32 EndEdge = Chain.bIsClosedLoop ? Chain.Seed.Edge : LastLink.Edge;
 
-		for (int i = 0; i < Chains.Num(); i++)
+		if (EndEdge != Seed.Edge)
 		{
-			const TSharedPtr<FNodeChain>& Chain = Chains[i];
+			// Claim the last edge; if the other end already owns it, both ends were walked concurrently and the lowest seed wins
+			const int32 EndOwner = FPlatformAtomics::InterlockedCompareExchange(&EdgeOwners[EndEdge], SeedIndex, -1);
+			if (EndOwner != -1 && EndOwner < SeedIndex)
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				OutLinks.SetNum(LinksStart, false);
+#else
+				OutLinks.SetNum(LinksStart, EAllowShrinking::No);
+#endif
+				return;
+			}
+		}
+
+		Chain.NumLinks = OutLinks.Num() - LinksStart;
+		Chain.LinksStart = LinksStart;
+		if (Chain.NumLinks <= 1) { Chain.SingleEdge = Seed.Edge; }
 
-			bool bAlreadySet = false;
-			UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
+		Chain.bIsLeaf = !Chain.bIsClosedLoop && (Cluster->GetNode(Seed.Node)->IsLeaf() || Cluster->GetNode(LastLink.Node)->IsLeaf());
+
+		// Store the walk in the slot of the lowest seed, so the output doesn't depend on which end won the claim
+		const int32 OtherSeed = GetSeedIndex(EndNode, EndEdge);
+		const int32 CanonicalSeed = OtherSeed == -1 ? SeedIndex : FMath::Min(SeedIndex, OtherSeed);
+
+		FWalk& Walk = Walks[CanonicalSeed];
+		Walk.Chain = Chain;
+		Walk.ScopeIndex = ScopeIndex;
+		Walk.bReverse = CanonicalSeed != SeedIndex;
+	}
 
-			if (bAlreadySet) { Chains[i] = nullptr; }
+	void FNodeChainBuilder::Gather()
+	{
+		TArray<int32> ReadIndices;
+		const int32 NumChains = PCGExMT::GetCompactionIndices(ReadIndices, Walks.Num(), [&](const int32 i) { return Walks[i].ScopeIndex != -1; });
+
+		Chains.SetNumUninitialized(NumChains);
+
+		int32 NumLinks = 0;
+		for (int i = 0; i < NumChains; i++)
+		{
+			FNodeChain& Chain = Chains[i] = Walks[ReadIndices[i]].Chain;
+			Chain.LinksStart = NumLinks;
+			NumLinks += Chain.NumLinks;
 		}
+
+		Links.SetNumUninitialized(NumLinks);
+
+		PCGExMT::ParallelForBlocking(
+			NumChains, [&](const int32 i)
+			{
+				const FWalk& Walk = Walks[ReadIndices[i]];
+				FNodeChain& Chain = Chains[i];
+
+				const FLink* Src = ScopeLinks[Walk.ScopeIndex].GetData() + Walk.Chain.LinksStart;
+				FLink* Dst = Links.GetData() + Chain.LinksStart;
+				const int32 K = Chain.NumLinks;
+
+				if (!Walk.bReverse)
+				{
+					FMemory::Memcpy(Dst, Src, K * sizeof(FLink));
+					return;
+				}
+
+				// Rewrite the chain as if it had been walked from its other end
+				const FLink& Seed = Walk.Chain.Seed;
+
+				if (Chain.bIsClosedLoop)
+				{
+					for (int j = 0; j < K; j++) { Dst[j] = FLink(Src[K - 1 - j].Node, j == 0 ? Seed.Edge : Src[K - j].Edge); }
+					Chain.Seed = FLink(Seed.Node, Src[0].Edge);
+				}
+				else
+				{
+					for (int j = 0; j < K; j++) { Dst[j] = FLink(j == K - 1 ? Seed.Node : Src[K - 2 - j].Node, Src[K - 1 - j].Edge); }
+					Chain.Seed = FLink(Src[K - 1].Node, Src[K - 1].Edge);
+				}
+			});
+
+		Seeds.Empty();
+		SeedOffsets.Empty();
+		EdgeOwners.Empty();
+		Walks.Empty();
+		ScopeLinks.Empty();
 	}
 }
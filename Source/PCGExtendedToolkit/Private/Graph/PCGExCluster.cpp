@@ -157,6 +157,24 @@ namespace PCGExCluster
 		}
 	}
 
+	TSharedPtr<FCluster> FCluster::MakeInstance(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TSharedPtr<FCluster> Instance = MakeShared<FCluster>(InVtxIO, InEdgesIO, NodeIndexLookup);
+
+		Instance->bIsMirror = true;
+		Instance->OriginalCluster = SharedThis(this);
+
+		Instance->bValid = bValid;
+		Instance->bIsOneToOne = bIsOneToOne;
+		Instance->NumRawVtx = InVtxIO->GetNum();
+		Instance->NumRawEdges = InEdgesIO->GetNum();
+
+		Instance->Nodes = Nodes;
+		Instance->Edges = Edges;
+
+		return Instance;
+	}
+
 	void FCluster::ClearInheritedForChanges(const bool bClearOwned)
 	{
 		WillModifyVtxIO(bClearOwned);
@@ -180,7 +198,7 @@ namespace PCGExCluster
 	}
 
 	bool FCluster::BuildFrom(
-		const TMap<uint32, int32>& InEndpointsLookup,
+		const PCGExGraph::FEndpointsLookup& InEndpointsLookup,
 		const TArray<int32>* InExpectedAdjacency,
 		const PCGExData::ESource PointsSource)
 	{
@@ -194,6 +212,16 @@ namespace PCGExCluster
 
 		const TArray<FPCGPoint>& InNodePoints = PinnedVtxIO->GetPoints(PointsSource);
 
+		// Input positions are shared through the points cache, only output data still goes through FPCGPoint
+		TArray<FVector> OutNodePositions;
+		if (PointsSource == PCGExData::ESource::Out)
+		{
+			PCGEx::InitArray(OutNodePositions, InNodePoints.Num());
+			for (int i = 0; i < InNodePoints.Num(); i++) { OutNodePositions[i] = InNodePoints[i].Transform.GetLocation(); }
+		}
+
+		const TConstArrayView<FVector> InNodePositions = PointsSource == PCGExData::ESource::In ? PinnedVtxIO->GetInPositions() : TConstArrayView<FVector>(OutNodePositions);
+
 		Nodes->Empty();
 		Edges->Empty();
 
@@ -223,18 +251,18 @@ namespace PCGExCluster
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
 
-			const int32* StartPointIndexPtr = InEndpointsLookup.Find(A);
-			const int32* EndPointIndexPtr = InEndpointsLookup.Find(B);
+			const int32 StartPointIndex = InEndpointsLookup.Find(A);
+			const int32 EndPointIndex = InEndpointsLookup.Find(B);
 
-			if ((!StartPointIndexPtr || !EndPointIndexPtr || *StartPointIndexPtr == *EndPointIndexPtr)) { return OnFail(); }
+			if (StartPointIndex == -1 || EndPointIndex == -1 || StartPointIndex == EndPointIndex) { return OnFail(); }
 
-			const int32 StartNode = GetOrCreateNode_Unsafe(InNodePoints, *StartPointIndexPtr);
-			const int32 EndNode = GetOrCreateNode_Unsafe(InNodePoints, *EndPointIndexPtr);
+			const int32 StartNode = GetOrCreateNode_Unsafe(InNodePositions, StartPointIndex);
+			const int32 EndNode = GetOrCreateNode_Unsafe(InNodePositions, EndPointIndex);
 
 			(Nodes->GetData() + StartNode)->Link(EndNode, i);
 			(Nodes->GetData() + EndNode)->Link(StartNode, i);
 
-			*(Edges->GetData() + i) = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			*(Edges->GetData() + i) = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 		}
 
 		if (InExpectedAdjacency)
@@ -331,8 +359,21 @@ namespace PCGExCluster
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeOctree);
 
-		const FPCGPoint* StartPtr = VtxPoints->GetData();
 		NodeOctree = MakeShared<PCGEx::FIndexedItemOctree>(Bounds.GetCenter(), (Bounds.GetExtent() + FVector(10)).Length());
+
+		if (const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = VtxIO.Pin())
+		{
+			const TConstArrayView<FBox> PointBounds = PinnedVtxIO->GetInBounds();
+			for (int i = 0; i < Nodes->Num(); i++)
+			{
+				const FNode* Node = Nodes->GetData() + i;
+				NodeOctree->AddElement(PCGEx::FIndexedItem(Node->Index, FBoxSphereBounds(PointBounds[Node->PointIndex])));
+			}
+
+			return;
+		}
+
+		const FPCGPoint* StartPtr = VtxPoints->GetData();
 		for (int i = 0; i < Nodes->Num(); i++)
 		{
 			const FNode* Node = Nodes->GetData() + i;
@@ -638,9 +679,23 @@ namespace PCGExCluster
 
 	void FCluster::UpdatePositions()
 	{
-		const TArray<FPCGPoint>& VtxPointsRef = *VtxPoints;
 		NodePositions.SetNumUninitialized(Nodes->Num());
 		Bounds = FBox(ForceInit);
+
+		if (const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = VtxIO.Pin())
+		{
+			const TConstArrayView<FVector> VtxPositions = PinnedVtxIO->GetInPositions();
+			for (const FNode& N : *Nodes)
+			{
+				const FVector Pos = VtxPositions[N.PointIndex];
+				NodePositions[N.Index] = Pos;
+				Bounds += Pos;
+			}
+
+			return;
+		}
+
+		const TArray<FPCGPoint>& VtxPointsRef = *VtxPoints;
 		for (const FNode& N : *Nodes)
 		{
 			const FVector Pos = VtxPointsRef[N.PointIndex].Transform.GetLocation();
@@ -734,9 +789,8 @@ bool FPCGExEdgeDirectionSettings::SortEndpoints(const PCGExCluster::FCluster* In
 	}
 	else if (DirectionMethod == EPCGExEdgeDirectionMethod::EdgeDotAttribute)
 	{
-		// TODO : Might be faster to use the EndpointLookup with GetPos ?
-		const FVector A = (InCluster->VtxPoints->GetData() + Start)->Transform.GetLocation();
-		const FVector B = (InCluster->VtxPoints->GetData() + End)->Transform.GetLocation();
+		const FVector A = InCluster->GetStartPos(InEdge);
+		const FVector B = InCluster->GetEndPos(InEdge);
 
 		const FVector& EdgeDir = (A - B).GetSafeNormal();
 		const FVector& CounterDir = EdgeDirReader->Read(InEdge.Index);
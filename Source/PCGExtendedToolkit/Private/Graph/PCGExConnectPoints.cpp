@@ -146,6 +146,19 @@ namespace PCGExConnectPoints
 
 		NumChainedOps = ChainProbeOperations.Num();
 
+		// Only pay for sorting what shared probes actually consume
+		NumSortedCandidates = 0;
+		for (const UPCGExProbeOperation* Op : SharedProbeOperations)
+		{
+			const int32 NumRequired = Op->GetRequiredSortedCandidates(bPreventCoincidence);
+			if (NumRequired < 0)
+			{
+				NumSortedCandidates = -1;
+				break;
+			}
+			NumSortedCandidates = FMath::Max(NumSortedCandidates, NumRequired);
+		}
+
 		if (SearchProbes.IsEmpty() && DirectProbes.IsEmpty()) { return false; }
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
@@ -212,26 +225,25 @@ namespace PCGExConnectPoints
 
 		if (!SearchProbes.IsEmpty())
 		{
-			constexpr double PPRefRadius = 0.05;
-			const FVector PPRefExtents = FVector(PPRefRadius);
+			if (bUseProjection) { for (int i = 0; i < NumPoints; i++) { CachedTransforms[i] = ProjectionDetails.ProjectFlat(InPointsRef[i].Transform, i); } }
+			else { for (int i = 0; i < NumPoints; i++) { CachedTransforms[i] = InPointsRef[i].Transform; } }
+
+			if (!bUseVariableRadius && SharedSearchRadius > 0) { bUseGrid = BuildGrid(); }
 
-			if (bUseProjection)
+			if (!bUseGrid)
 			{
+				constexpr double PPRefRadius = 0.05;
+				const FVector PPRefExtents = FVector(PPRefRadius);
+
 				for (int i = 0; i < NumPoints; i++)
 				{
-					CachedTransforms[i] = ProjectionDetails.ProjectFlat(InPointsRef[i].Transform, i);
 					if (!AcceptConnections[i]) { continue; }
 					Octree->AddElement(PCGEx::FIndexedItem(i, FBoxSphereBounds(CachedTransforms[i].GetLocation(), PPRefExtents, PPRefRadius)));
 				}
 			}
 			else
 			{
-				for (int i = 0; i < NumPoints; i++)
-				{
-					CachedTransforms[i] = InPointsRef[i].Transform;
-					if (!AcceptConnections[i]) { continue; }
-					Octree->AddElement(PCGEx::FIndexedItem(i, FBoxSphereBounds(CachedTransforms[i].GetLocation(), PPRefExtents, PPRefRadius)));
-				}
+				Octree.Reset();
 			}
 		}
 
@@ -241,6 +253,81 @@ namespace PCGExConnectPoints
 		StartParallelLoopForPoints(PCGExData::ESource::In);
 	}
 
+	bool FProcessor::BuildGrid()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExConnectPoints::BuildGrid);
+
+		const int32 NumPoints = CachedTransforms.Num();
+
+		FBox Bounds(ForceInit);
+		for (int i = 0; i < NumPoints; i++) { if (AcceptConnections[i]) { Bounds += CachedTransforms[i].GetLocation(); } }
+
+		if (!Bounds.IsValid) { return false; }
+		if (!FMath::IsFinite(SharedSearchRadius) || SharedSearchRadius <= 0) { return false; }
+
+		GridInvCellSize = 1 / SharedSearchRadius;
+		GridOrigin = Bounds.Min;
+
+		// Sparse data relative to the radius would waste memory on empty cells, the octree handles that better.
+		// Checked in double, per axis then as a whole, so tiny radii over large bounds can't overflow the cell count.
+		const double MaxCells = FMath::Max(1024.0, static_cast<double>(NumPoints) * 4);
+
+		const FVector Size = Bounds.GetSize() * GridInvCellSize;
+		const FVector Dims = FVector(FMath::Floor(Size.X), FMath::Floor(Size.Y), FMath::Floor(Size.Z)) + FVector::OneVector;
+
+		if (Dims.ContainsNaN() || Dims.X > MaxCells || Dims.Y > MaxCells || Dims.Z > MaxCells) { return false; }
+		if (Dims.X * Dims.Y * Dims.Z > MaxCells) { return false; }
+
+		GridDims = FIntVector(static_cast<int32>(Dims.X), static_cast<int32>(Dims.Y), static_cast<int32>(Dims.Z));
+		const int32 NumCells = GridDims.X * GridDims.Y * GridDims.Z;
+
+		// Counting sort of connectable points per cell
+
+		TArray<int32> PointCells;
+		PointCells.Init(-1, NumPoints);
+		GridCellStarts.Reset();
+		GridCellStarts.SetNumZeroed(NumCells + 1);
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			if (!AcceptConnections[i]) { continue; }
+
+			const FVector P = (CachedTransforms[i].GetLocation() - GridOrigin) * GridInvCellSize;
+			const int32 X = FMath::Clamp(FMath::FloorToInt32(P.X), 0, GridDims.X - 1);
+			const int32 Y = FMath::Clamp(FMath::FloorToInt32(P.Y), 0, GridDims.Y - 1);
+			const int32 Z = FMath::Clamp(FMath::FloorToInt32(P.Z), 0, GridDims.Z - 1);
+
+			const int32 Cell = (Z * GridDims.Y + Y) * GridDims.X + X;
+			PointCells[i] = Cell;
+			GridCellStarts[Cell + 1]++;
+		}
+
+		for (int i = 0; i < NumCells; i++) { GridCellStarts[i + 1] += GridCellStarts[i]; }
+
+		const int32 NumGridPoints = GridCellStarts[NumCells];
+
+		TArray<int32> WriteIndices = GridCellStarts;
+		PCGEx::InitArray(GridPointIndices, NumGridPoints);
+		PCGEx::InitArray(GridX, NumGridPoints);
+		PCGEx::InitArray(GridY, NumGridPoints);
+		PCGEx::InitArray(GridZ, NumGridPoints);
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			if (PointCells[i] == -1) { continue; }
+
+			const int32 WriteIndex = WriteIndices[PointCells[i]]++;
+			const FVector P = CachedTransforms[i].GetLocation();
+
+			GridPointIndices[WriteIndex] = i;
+			GridX[WriteIndex] = P.X;
+			GridY[WriteIndex] = P.Y;
+			GridZ[WriteIndex] = P.Z;
+		}
+
+		return true;
+	}
+
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
 	{
 		FPointsProcessor::PrepareLoopScopesForPoints(Loops);
@@ -288,39 +375,113 @@ namespace PCGExConnectPoints
 				for (const UPCGExProbeOperation* Op : SearchProbes) { MaxRadius = FMath::Max(MaxRadius, Op->SearchRadiusCache ? Op->SearchRadiusCache->Read(Index) : Op->SearchRadius); }
 			}
 
+			// Every probe rejects candidates beyond its own radius, so anything outside the largest one can be dropped right away
+			const double MaxRadiusSquared = FMath::Square(MaxRadius);
 			const FVector Origin = CachedTransforms[Index].GetLocation();
 
 			TArray<PCGExProbing::FCandidate> Candidates;
 
-			auto ProcessPoint = [&](const PCGEx::FIndexedItem& InPositionRef)
+			auto AddCandidate = [&](const int32 OtherPointIndex, const FVector& Position, const double DistSquared)
 			{
-				const int32 OtherPointIndex = InPositionRef.Index;
-				if (OtherPointIndex == Index) { return; }
-
-				const FVector Position = CachedTransforms[OtherPointIndex].GetLocation();
 				const FVector Dir = (Origin - Position).GetSafeNormal();
 				const int32 EmplaceIndex = Candidates.Emplace(
 					OtherPointIndex,
 					Dir,
-					FVector::DistSquared(Position, Origin),
+					DistSquared,
 					bPreventCoincidence ? PCGEx::I323(Dir, CWCoincidenceTolerance) : FInt32Vector::ZeroValue);
 
 				if (NumChainedOps > 0) { for (int i = 0; i < NumChainedOps; i++) { ChainProbeOperations[i]->ProcessCandidateChained(i, PointCopy, EmplaceIndex, Candidates[EmplaceIndex], BestCandidates[i]); } }
 			};
 
-			Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+			if (bUseGrid)
+			{
+				const FVector MinCell = (Origin - FVector(MaxRadius) - GridOrigin) * GridInvCellSize;
+				const FVector MaxCell = (Origin + FVector(MaxRadius) - GridOrigin) * GridInvCellSize;
 
-			if (NumChainedOps > 0) { for (int i = 0; i < NumChainedOps; i++) { ChainProbeOperations[i]->ProcessBestCandidate(Index, PointCopy, BestCandidates[i], Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges); } }
+				const int32 MinX = FMath::Max(0, FMath::FloorToInt32(MinCell.X));
+				const int32 MinY = FMath::Max(0, FMath::FloorToInt32(MinCell.Y));
+				const int32 MinZ = FMath::Max(0, FMath::FloorToInt32(MinCell.Z));
+				const int32 MaxX = FMath::Min(GridDims.X - 1, FMath::FloorToInt32(MaxCell.X));
+				const int32 MaxY = FMath::Min(GridDims.Y - 1, FMath::FloorToInt32(MaxCell.Y));
+				const int32 MaxZ = FMath::Min(GridDims.Z - 1, FMath::FloorToInt32(MaxCell.Z));
 
-			if (!Candidates.IsEmpty())
-			{
-				Algo::Sort(Candidates, [&](const PCGExProbing::FCandidate& A, const PCGExProbing::FCandidate& B) { return A.Distance < B.Distance; });
-				for (UPCGExProbeOperation* Op : SharedProbeOperations) { Op->ProcessCandidates(Index, PointCopy, Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges); }
+				constexpr int32 NumLanes = 64;
+				double DistSquared[NumLanes];
+
+				for (int32 Z = MinZ; Z <= MaxZ; Z++)
+				{
+					for (int32 Y = MinY; MinX <= MaxX && Y <= MaxY; Y++)
+					{
+						// Cells along X are contiguous, walk the whole row at once
+						const int32 RowCell = (Z * GridDims.Y + Y) * GridDims.X;
+						const int32 End = GridCellStarts[RowCell + MaxX + 1];
+
+						for (int32 Start = GridCellStarts[RowCell + MinX]; Start < End; Start += NumLanes)
+						{
+							const int32 NumInLanes = FMath::Min(NumLanes, End - Start);
+
+							// Distance pass over SoA lanes, kept branchless so it vectorizes
+							for (int32 l = 0; l < NumInLanes; l++)
+							{
+								const double DX = GridX[Start + l] - Origin.X;
+								const double DY = GridY[Start + l] - Origin.Y;
+								const double DZ = GridZ[Start + l] - Origin.Z;
+								DistSquared[l] = DX * DX + DY * DY + DZ * DZ;
+							}
+
+							for (int32 l = 0; l < NumInLanes; l++)
+							{
+								if (DistSquared[l] > MaxRadiusSquared) { continue; }
+
+								const int32 k = Start + l;
+								if (GridPointIndices[k] == Index) { continue; }
+
+								AddCandidate(GridPointIndices[k], FVector(GridX[k], GridY[k], GridZ[k]), DistSquared[l]);
+							}
+						}
+					}
+				}
 			}
 			else
 			{
-				for (UPCGExProbeOperation* Op : SharedProbeOperations) { Op->ProcessCandidates(Index, PointCopy, Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges); }
+				Octree->FindElementsWithBoundsTest(
+					FBoxCenterAndExtent(Origin, FVector(MaxRadius)), [&](const PCGEx::FIndexedItem& InPositionRef)
+					{
+						const int32 OtherPointIndex = InPositionRef.Index;
+						if (OtherPointIndex == Index) { return; }
+
+						const FVector Position = CachedTransforms[OtherPointIndex].GetLocation();
+						const double DistSquared = FVector::DistSquared(Position, Origin);
+						if (DistSquared > MaxRadiusSquared) { return; }
+
+						AddCandidate(OtherPointIndex, Position, DistSquared);
+					});
 			}
+
+			if (NumChainedOps > 0) { for (int i = 0; i < NumChainedOps; i++) { ChainProbeOperations[i]->ProcessBestCandidate(Index, PointCopy, BestCandidates[i], Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges); } }
+
+			if (Candidates.Num() > 1 && NumSortedCandidates != 0)
+			{
+				auto SortPredicate = [](const PCGExProbing::FCandidate& A, const PCGExProbing::FCandidate& B) { return A.Distance < B.Distance; };
+
+				if (NumSortedCandidates < 0 || NumSortedCandidates > 32 || NumSortedCandidates >= Candidates.Num()) { Algo::Sort(Candidates, SortPredicate); }
+				else
+				{
+					// Top-k : keep the k closest sorted at the front, the rest is left as-is
+					const int32 K = NumSortedCandidates;
+					Algo::Sort(MakeArrayView(Candidates.GetData(), K), SortPredicate);
+
+					for (int i = K; i < Candidates.Num(); i++)
+					{
+						if (!SortPredicate(Candidates[i], Candidates[K - 1])) { continue; }
+
+						Swap(Candidates[i], Candidates[K - 1]);
+						for (int j = K - 1; j > 0 && SortPredicate(Candidates[j], Candidates[j - 1]); j--) { Swap(Candidates[j], Candidates[j - 1]); }
+					}
+				}
+			}
+
+			for (UPCGExProbeOperation* Op : SharedProbeOperations) { Op->ProcessCandidates(Index, PointCopy, Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges); }
 		}
 
 		for (UPCGExProbeOperation* Op : DirectProbes) { Op->ProcessNode(Index, PointCopy, LocalCoincidence.Get(), CWCoincidenceTolerance, UniqueEdges, AcceptConnections); }
@@ -328,8 +489,21 @@ namespace PCGExConnectPoints
 
 	void FProcessor::CompleteWork()
 	{
-		DistributedEdgesSet->ForEach([this](const TSet<uint64>& Edges) { GraphBuilder->Graph->InsertEdges_Unsafe(Edges, -1); });
-		DistributedEdgesSet.Reset();
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExConnectPoints::InsertEdges);
+
+			// Flatten scoped sets in parallel and insert everything in one bulk pass, instead of merging them one after the other
+			TArray<TArray<uint64>> ScopedEdges;
+			ScopedEdges.SetNum(DistributedEdgesSet->Sets.Num());
+			PCGExMT::ParallelForBlocking(ScopedEdges.Num(), [&](const int32 i) { ScopedEdges[i] = DistributedEdgesSet->Sets[i]->Array(); });
+			DistributedEdgesSet.Reset();
+
+			TArray<TConstArrayView<uint64>> EdgeBatches;
+			EdgeBatches.Reserve(ScopedEdges.Num());
+			for (const TArray<uint64>& Edges : ScopedEdges) { EdgeBatches.Add(Edges); }
+
+			GraphBuilder->Graph->InsertEdges_Unsafe(EdgeBatches, -1);
+		}
 
 		GraphBuilder->CompileAsync(AsyncManager, false);
 	}
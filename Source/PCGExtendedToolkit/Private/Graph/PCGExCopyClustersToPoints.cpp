@@ -54,6 +54,7 @@ bool FPCGExCopyClustersToPointsElement::ExecuteInternal(FPCGContext* InContext)
 			[](const TSharedPtr<PCGExData::FPointIOTaggedEntries>& Entries) { return true; },
 			[&](const TSharedPtr<PCGExCopyClusters::FBatch>& NewBatch)
 			{
+				NewBatch->bUsePersistentClusterCache = Settings->bInstanceTopology;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not build any clusters."));
@@ -76,6 +77,9 @@ namespace PCGExCopyClusters
 
 	bool FProcessor::Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
 	{
+		// Instancing needs the source topology, either forwarded from upstream or built once here
+		bBuildCluster = Settings->bInstanceTopology && GetDefault<UPCGExGlobalSettings>()->bCacheClusters;
+
 		if (!FClusterProcessor::Process(InAsyncManager)) { return false; }
 
 		const TArray<FPCGPoint>& Targets = Context->TargetsDataFacade->GetIn()->GetPoints();
@@ -103,7 +107,7 @@ namespace PCGExCopyClusters
 		const int32 NumTargets = Targets.Num();
 
 		// Once work is complete, check if there are cached clusters we can forward
-		const TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
+		const TSharedPtr<PCGExCluster::FCluster> CachedCluster = Cluster ? Cluster : PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
 
 		for (int i = 0; i < NumTargets; i++)
 		{
@@ -121,7 +125,14 @@ namespace PCGExCopyClusters
 			TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
 
 			UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
-			if (CachedCluster && EdgeDupeTypedData)
+			if (!EdgeDupeTypedData) { continue; }
+
+			if (Cluster)
+			{
+				// Share topology only ; copies are transformed so positions will be resolved by whoever consumes them
+				EdgeDupeTypedData->SetBoundCluster(Cluster->MakeInstance(VtxDupe, EdgeDupe));
+			}
+			else
 			{
 				EdgeDupeTypedData->SetBoundCluster(
 					MakeShared<PCGExCluster::FCluster>(
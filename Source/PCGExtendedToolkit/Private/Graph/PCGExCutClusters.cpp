@@ -57,7 +57,6 @@ bool FPCGExCutEdgesElement::Boot(FPCGExContext* InContext) const
 	}
 
 	Context->PathFacades.Reserve(PathCollection->Num());
-	Context->Paths.Reserve(PathCollection->Num());
 
 	int32 ExcludedNum = 0;
 
@@ -86,6 +85,8 @@ bool FPCGExCutEdgesElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->Paths.SetNum(Context->PathFacades.Num());
+
 	PCGEX_FWD(ClosedLoop)
 	Context->ClosedLoop.Init();
 
@@ -113,9 +114,7 @@ bool FPCGExCutEdgesElement::ExecuteInternal(
 					PathFacade->Source->GetIn()->GetPoints(), 0,
 					Context->ClosedLoop.IsClosedLoop(PathFacade->Source));
 
-				Path->BuildEdgeOctree();
-
-				Context->Paths.Add(Path.ToSharedRef());
+				Context->Paths[Scope.Start] = Path;
 			};
 
 		BuildPathsTask->StartSubLoops(Context->PathFacades.Num(), 1);
@@ -123,6 +122,10 @@ bool FPCGExCutEdgesElement::ExecuteInternal(
 
 	PCGEX_ON_ASYNC_STATE_READY(PCGExPaths::State_BuildingPaths)
 	{
+		Context->EdgeBVH = MakeShared<PCGExPaths::FPathEdgeBVH>();
+		for (const TSharedPtr<PCGExPaths::FPath>& Path : Context->Paths) { Context->EdgeBVH->AddPath(Path); }
+		Context->EdgeBVH->Build();
+
 		if (!Context->StartProcessingClusters<PCGExCutEdges::FBatch>(
 			[](const TSharedPtr<PCGExData::FPointIOTaggedEntries>& Entries) { return true; },
 			[&](const TSharedPtr<PCGExCutEdges::FBatch>& NewBatch)
@@ -220,63 +223,52 @@ namespace PCGExCutEdges
 		const FVector B1 = VtxDataFacade->Source->GetInPoint(Edge.End).Transform.GetLocation();
 		const FVector Dir = (B1 - A1).GetSafeNormal();
 
-		FBox EdgeBox = FBox(ForceInit);
-		EdgeBox += A1;
-		EdgeBox += B1;
-
-		for (const TSharedRef<PCGExPaths::FPath>& Path : Context->Paths)
-		{
-			if (!Path->Bounds.Intersect(EdgeBox)) { continue; }
+		// Check paths
+		Context->EdgeBVH->FindFirstSegmentCandidate(
+			A1, B1, Context->IntersectionDetails.Tolerance, [&](const PCGExPaths::FPath* Path, const PCGExPaths::FPathEdge& PathEdge)
+			{
+				//if (Settings->bInvert) { if (Edge.bValid) { return false; } }
+				//else if (!Edge.bValid) { return false; }
 
-			// Check paths
-			Path->GetEdgeOctree()->FindFirstElementWithBoundsTest(
-				EdgeBox, [&](const PCGExPaths::FPathEdge* PathEdge)
+				if (Context->IntersectionDetails.bUseMinAngle || Context->IntersectionDetails.bUseMaxAngle)
 				{
-					//if (Settings->bInvert) { if (Edge.bValid) { return false; } }
-					//else if (!Edge.bValid) { return false; }
-
-					if (Context->IntersectionDetails.bUseMinAngle || Context->IntersectionDetails.bUseMaxAngle)
+					if (!Context->IntersectionDetails.CheckDot(FMath::Abs(FVector::DotProduct(PathEdge.Dir, Dir))))
 					{
-						if (!Context->IntersectionDetails.CheckDot(FMath::Abs(FVector::DotProduct(PathEdge->Dir, Dir))))
-						{
-							return true;
-						}
+						return true;
 					}
+				}
 
-					const FVector A2 = Path->GetPos_Unsafe(PathEdge->Start);
-					const FVector B2 = Path->GetPos_Unsafe(PathEdge->End);
-					FVector A = FVector::ZeroVector;
-					FVector B = FVector::ZeroVector;
+				const FVector A2 = Path->GetPos_Unsafe(PathEdge.Start);
+				const FVector B2 = Path->GetPos_Unsafe(PathEdge.End);
+				FVector A = FVector::ZeroVector;
+				FVector B = FVector::ZeroVector;
 
-					FMath::SegmentDistToSegment(A1, B1, A2, B2, A, B);
-					//if (A == A1 || A == B1 || B == A2 || B == B2) { return true; }
+				FMath::SegmentDistToSegment(A1, B1, A2, B2, A, B);
+				//if (A == A1 || A == B1 || B == A2 || B == B2) { return true; }
 
-					if (FVector::DistSquared(A, B) >= Context->IntersectionDetails.ToleranceSquared) { return true; }
+				if (FVector::DistSquared(A, B) >= Context->IntersectionDetails.ToleranceSquared) { return true; }
 
-					PCGExCluster::FNode* StartNode = Cluster->GetEdgeStart(Edge);
-					PCGExCluster::FNode* EndNode = Cluster->GetEdgeEnd(Edge);
+				PCGExCluster::FNode* StartNode = Cluster->GetEdgeStart(Edge);
+				PCGExCluster::FNode* EndNode = Cluster->GetEdgeEnd(Edge);
 
-					if (Settings->bInvert)
+				if (Settings->bInvert)
+				{
+					FPlatformAtomics::InterlockedExchange(&Edge.bValid, 1);
+					FPlatformAtomics::InterlockedExchange(&StartNode->bValid, 1);
+					FPlatformAtomics::InterlockedExchange(&EndNode->bValid, 1);
+				}
+				else
+				{
+					FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
+					if (Settings->bAffectedEdgesAffectEndpoints)
 					{
-						FPlatformAtomics::InterlockedExchange(&Edge.bValid, 1);
-						FPlatformAtomics::InterlockedExchange(&StartNode->bValid, 1);
-						FPlatformAtomics::InterlockedExchange(&EndNode->bValid, 1);
+						FPlatformAtomics::InterlockedExchange(&StartNode->bValid, 0);
+						FPlatformAtomics::InterlockedExchange(&EndNode->bValid, 0);
 					}
-					else
-					{
-						FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
-						if (Settings->bAffectedEdgesAffectEndpoints)
-						{
-							FPlatformAtomics::InterlockedExchange(&StartNode->bValid, 0);
-							FPlatformAtomics::InterlockedExchange(&EndNode->bValid, 0);
-						}
-					}
-
-					return false;
-				});
+				}
 
-			if (Edge.bValid == static_cast<int8>(Settings->bInvert)) { return; }
-		}
+				return false;
+			});
 	}
 
 	void FProcessor::PrepareSingleLoopScopeForNodes(const PCGExMT::FScope& Scope)
@@ -298,53 +290,46 @@ namespace PCGExCutEdges
 		const FVector A1 = NodePoint.Transform.GetLocation();
 		FBox PointBox = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::Bounds>(NodePoint).ExpandBy(Settings->NodeExpansion + Settings->IntersectionDetails.ToleranceSquared).TransformBy(NodePoint.Transform);
 
-		for (const TSharedRef<PCGExPaths::FPath>& Path : Context->Paths)
-		{
-			if (!Path->Bounds.Intersect(PointBox)) { continue; }
-
-			// Check paths
-			Path->GetEdgeOctree()->FindFirstElementWithBoundsTest(
-				PointBox, [&](const PCGExPaths::FPathEdge* PathEdge)
-				{
-					//if (Settings->bInvert) { if (Node.bValid) { return false; } }
-					//else if (!Node.bValid) { return false; }
+		// Check paths
+		Context->EdgeBVH->FindFirstElementWithBoundsTest(
+			PointBox, [&](const PCGExPaths::FPath* Path, const PCGExPaths::FPathEdge& PathEdge)
+			{
+				//if (Settings->bInvert) { if (Node.bValid) { return false; } }
+				//else if (!Node.bValid) { return false; }
 
-					const FVector A2 = Path->GetPos_Unsafe(PathEdge->Start);
-					const FVector B2 = Path->GetPos_Unsafe(PathEdge->End);
+				const FVector A2 = Path->GetPos_Unsafe(PathEdge.Start);
+				const FVector B2 = Path->GetPos_Unsafe(PathEdge.End);
 
-					const FVector B1 = FMath::ClosestPointOnSegment(A1, A2, B2);
-					const FVector C1 = Context->DistanceDetails->GetSourceCenter(NodePoint, A1, B1);
+				const FVector B1 = FMath::ClosestPointOnSegment(A1, A2, B2);
+				const FVector C1 = Context->DistanceDetails->GetSourceCenter(NodePoint, A1, B1);
 
-					if (FVector::DistSquared(B1, C1) >= Context->IntersectionDetails.ToleranceSquared) { return true; }
+				if (FVector::DistSquared(B1, C1) >= Context->IntersectionDetails.ToleranceSquared) { return true; }
 
-					if (Settings->bInvert)
+				if (Settings->bInvert)
+				{
+					FPlatformAtomics::InterlockedExchange(&Node.bValid, 1);
+					if (Settings->bAffectedNodesAffectConnectedEdges)
 					{
-						FPlatformAtomics::InterlockedExchange(&Node.bValid, 1);
-						if (Settings->bAffectedNodesAffectConnectedEdges)
+						for (const PCGExGraph::FLink Lk : Node.Links)
 						{
-							for (const PCGExGraph::FLink Lk : Node.Links)
-							{
-								FPlatformAtomics::InterlockedExchange(&(Cluster->GetEdge(Lk))->bValid, 1);
-								FPlatformAtomics::InterlockedExchange(&Cluster->GetNode(Lk)->bValid, 1);
-							}
+							FPlatformAtomics::InterlockedExchange(&(Cluster->GetEdge(Lk))->bValid, 1);
+							FPlatformAtomics::InterlockedExchange(&Cluster->GetNode(Lk)->bValid, 1);
 						}
 					}
-					else
+				}
+				else
+				{
+					FPlatformAtomics::InterlockedExchange(&Node.bValid, 0);
+					if (Settings->bAffectedNodesAffectConnectedEdges)
 					{
-						FPlatformAtomics::InterlockedExchange(&Node.bValid, 0);
-						if (Settings->bAffectedNodesAffectConnectedEdges)
+						for (const PCGExGraph::FLink Lk : Node.Links)
 						{
-							for (const PCGExGraph::FLink Lk : Node.Links)
-							{
-								FPlatformAtomics::InterlockedExchange(&(Cluster->GetEdge(Lk))->bValid, 0);
-							}
+							FPlatformAtomics::InterlockedExchange(&(Cluster->GetEdge(Lk))->bValid, 0);
 						}
 					}
-					return false;
-				});
-
-			if (Node.bValid == static_cast<int8>(Settings->bInvert)) { return; }
-		}
+				}
+				return false;
+			});
 	}
 
 	void FProcessor::OnEdgesProcessingComplete()
@@ -101,6 +101,7 @@ bool FPCGExFuseClustersElement::ExecuteInternal(FPCGContext* InContext) const
 			[&](const TSharedPtr<PCGExClusterMT::TBatch<PCGExFuseClusters::FProcessor>>& NewBatch)
 			{
 				NewBatch->bSkipCompletion = true;
+				NewBatch->bUsePersistentClusterCache = false;
 				NewBatch->bDaisyChainProcessing = bDoInline;
 			}, bDoInline))
 		{
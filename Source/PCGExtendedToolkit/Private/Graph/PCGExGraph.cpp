@@ -93,15 +93,20 @@ bool FPCGExGraphBuilderDetails::WantsClusters() const
 }
 
 bool FPCGExGraphBuilderDetails::IsValid(const TSharedPtr<PCGExGraph::FSubGraph>& InSubgraph) const
+{
+	return IsValid(InSubgraph->Nodes.Num(), InSubgraph->Edges.Num());
+}
+
+bool FPCGExGraphBuilderDetails::IsValid(const int32 NumVtx, const int32 NumEdges) const
 {
 	if (bRemoveBigClusters)
 	{
-		if (InSubgraph->Edges.Num() > MaxEdgeCount || InSubgraph->Nodes.Num() > MaxVtxCount) { return false; }
+		if (NumEdges > MaxEdgeCount || NumVtx > MaxVtxCount) { return false; }
 	}
 
 	if (bRemoveSmallClusters)
 	{
-		if (InSubgraph->Edges.Num() < MinEdgeCount || InSubgraph->Nodes.Num() < MinVtxCount) { return false; }
+		if (NumEdges < MinEdgeCount || NumVtx < MinVtxCount) { return false; }
 	}
 
 	return true;
@@ -109,6 +114,156 @@ bool FPCGExGraphBuilderDetails::IsValid(const TSharedPtr<PCGExGraph::FSubGraph>&
 
 namespace PCGExGraph
 {
+	void FEndpointsLookup::Build(const TArray<int64>& InPackedVtxIndices, TArray<int32>* OutAdjacency)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FEndpointsLookup::Build);
+
+		const int32 NumItems = InPackedVtxIndices.Num();
+
+		Empty();
+		if (OutAdjacency) { PCGEx::InitArray(*OutAdjacency, NumItems); }
+		if (!NumItems) { return; }
+
+		// Aim for small buckets, and cap the number of scopes so per-scope histograms stay cheap
+		const int32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Clamp(NumItems / 32, 1, 1 << 14));
+		BucketShift = 32 - FMath::FloorLog2(NumBuckets);
+
+		TArray<PCGExMT::FScope> Scopes;
+		const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumItems, FMath::Max(PCGExMT::CompactionScopeSize, FMath::DivideAndRoundUp(NumItems, 64)));
+		const bool bInline = NumScopes <= 1;
+
+		// Per-scope bucket histograms
+
+		TArray<int32> Offsets;
+		Offsets.SetNumZeroed(NumScopes * NumBuckets);
+
+		PCGExMT::ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				int32* Counts = Offsets.GetData() + ScopeIndex * NumBuckets;
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					uint32 A;
+					uint32 B;
+					PCGEx::H64(InPackedVtxIndices[i], A, B);
+					Counts[GetBucket(A)]++;
+					if (OutAdjacency) { (*OutAdjacency)[i] = B; }
+				}
+			}, bInline);
+
+		// Bucket-major exclusive prefix sum, so each scope writes a contiguous slice of each bucket
+
+		PCGEx::InitArray(BucketOffsets, NumBuckets + 1);
+
+		int32 Offset = 0;
+		for (int b = 0; b < NumBuckets; b++)
+		{
+			BucketOffsets[b] = Offset;
+			for (int s = 0; s < NumScopes; s++)
+			{
+				int32& Count = Offsets[s * NumBuckets + b];
+				const int32 ScopeCount = Count;
+				Count = Offset;
+				Offset += ScopeCount;
+			}
+		}
+		BucketOffsets[NumBuckets] = Offset;
+
+		// Scatter
+
+		Entries.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				int32* WriteIndices = Offsets.GetData() + ScopeIndex * NumBuckets;
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					const uint32 Key = PCGEx::H64A(InPackedVtxIndices[i]);
+					Entries[WriteIndices[GetBucket(Key)]++] = PCGEx::H64(Key, i);
+				}
+			}, bInline);
+
+		// Sort buckets
+
+		PCGExMT::ParallelForBlocking(
+			NumBuckets, [&](const int32 Bucket)
+			{
+				const int32 Start = BucketOffsets[Bucket];
+				const int32 Count = BucketOffsets[Bucket + 1] - Start;
+				if (Count > 1) { Algo::Sort(TArrayView<uint64>(Entries.GetData() + Start, Count)); }
+			}, bInline);
+	}
+
+	void FEndpointsLookup::Empty()
+	{
+		Entries.Empty();
+		BucketOffsets.Empty();
+		BucketShift = 32;
+	}
+
+	void FEdgeHashMap::Reserve(const int32 InNum)
+	{
+		const int32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(16, InNum * 2));
+		if (Capacity <= Keys.Num()) { return; }
+
+		TArray<uint64> OldKeys = MoveTemp(Keys);
+		TArray<int32> OldValues = MoveTemp(Values);
+
+		Keys.SetNumZeroed(Capacity);
+		Values.SetNumUninitialized(Capacity);
+		Mask = Capacity - 1;
+		NumItems = 0;
+
+		for (int i = 0; i < OldKeys.Num(); i++) { if (OldKeys[i] != 0) { Add(OldKeys[i], OldValues[i]); } }
+	}
+
+	void FEdgeHashMap::Empty()
+	{
+		Keys.Empty();
+		Values.Empty();
+		Mask = 0;
+		NumItems = 0;
+	}
+
+	bool FEdgeHashMap::Add(const uint64 Key, const int32 Value)
+	{
+		check(Key != 0)
+
+		if ((NumItems + 1) * 2 > Keys.Num()) { Reserve(FMath::Max(NumItems + 1, NumItems * 2)); }
+
+		for (uint64 Slot = GetSlot(Key);; Slot = (Slot + 1) & Mask)
+		{
+			const uint64 Other = Keys[Slot];
+			if (Other == Key) { return false; }
+			if (Other == 0)
+			{
+				Keys[Slot] = Key;
+				Values[Slot] = Value;
+				NumItems++;
+				return true;
+			}
+		}
+	}
+
+	void FEdgeHashMap::Add_Concurrent(const uint64 Key, const int32 Value)
+	{
+		check(Key != 0)
+
+		for (uint64 Slot = GetSlot(Key);; Slot = (Slot + 1) & Mask)
+		{
+			if (FPlatformAtomics::InterlockedCompareExchange(reinterpret_cast<volatile int64*>(&Keys[Slot]), static_cast<int64>(Key), 0) == 0)
+			{
+				Values[Slot] = Value;
+				break;
+			}
+		}
+
+		FPlatformAtomics::InterlockedIncrement(&NumItems);
+	}
+
 	void FSubGraph::Invalidate(FGraph* InGraph)
 	{
 		for (const int32 EdgeIndex : Edges) { InGraph->Edges[EdgeIndex].bValid = false; }
@@ -159,30 +314,29 @@ namespace PCGExGraph
 			TRACE_CPUPROFILER_EVENT_SCOPE(FWriteSubGraphEdges::GatherPreExistingPoints);
 
 			// Copy any existing point properties first
-			UPCGMetadata* Metadata = EdgesDataFacade->Source->GetOut()->Metadata;
 			const TArray<FPCGPoint>& InPoints = EdgesDataFacade->Source->GetIn()->GetPoints();
-			for (int i = 0; i < NumEdges; i++)
-			{
-				const FEdge& OE = ParentGraph->Edges[EdgeDump[i]];
-				FlattenedEdges[i] = FEdge(i, ParentGraph->Nodes[OE.Start].PointIndex, ParentGraph->Nodes[OE.End].PointIndex, i, OE.Index); // Use flat edge IOIndex to store original edge index
-				if (InPoints.IsValidIndex(OE.PointIndex)) { MutablePoints[i] = InPoints[OE.PointIndex]; }
-				Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry);
-			}
+			PCGExMT::ParallelForBlocking(
+				NumEdges, [&](const int32 i)
+				{
+					const FEdge& OE = ParentGraph->Edges[EdgeDump[i]];
+					FlattenedEdges[i] = FEdge(i, ParentGraph->Nodes[OE.Start].PointIndex, ParentGraph->Nodes[OE.End].PointIndex, i, OE.Index); // Use flat edge IOIndex to store original edge index
+					if (InPoints.IsValidIndex(OE.PointIndex)) { MutablePoints[i] = InPoints[OE.PointIndex]; }
+				});
 		}
 		else
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FWriteSubGraphEdges::CreatePoints);
 
-			UPCGMetadata* Metadata = EdgesDataFacade->Source->GetOut()->Metadata;
-
-			for (int i = 0; i < NumEdges; i++)
-			{
-				const FEdge& E = ParentGraph->Edges[EdgeDump[i]];
-				FlattenedEdges[i] = FEdge(i, ParentGraph->Nodes[E.Start].PointIndex, ParentGraph->Nodes[E.End].PointIndex, i, E.Index);
-				Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry);
-			}
+			PCGExMT::ParallelForBlocking(
+				NumEdges, [&](const int32 i)
+				{
+					const FEdge& E = ParentGraph->Edges[EdgeDump[i]];
+					FlattenedEdges[i] = FEdge(i, ParentGraph->Nodes[E.Start].PointIndex, ParentGraph->Nodes[E.End].PointIndex, i, E.Index);
+				});
 		}
 
+		EdgesDataFacade->Source->InitPoints();
+
 		MetadataDetails = InBuilder->GetMetadataDetails();
 		const bool bHasUnionMetadata = (MetadataDetails && InBuilder && !ParentGraph->EdgeMetadata.IsEmpty());
 
@@ -360,23 +514,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	void FGraph::InsertEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
 	{
 		FWriteScopeLock WriteLock(GraphLock);
-		uint32 A;
-		uint32 B;
-
-		for (const uint64& E : InEdges)
-		{
-			if (UniqueEdges.Contains(E)) { continue; }
-
-			PCGEx::H64(E, A, B);
-
-			check(A != B)
-
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			UniqueEdges.Add(E, EdgeIndex);
-			Nodes[A].LinkEdge(EdgeIndex);
-			Nodes[B].LinkEdge(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
-		}
+		InsertEdges_Unsafe(TArray<TConstArrayView<uint64>>{TConstArrayView<uint64>(InEdges)}, InIOIndex);
 	}
 
 	int32 FGraph::InsertEdges(const TArray<FEdge>& InEdges)
@@ -387,8 +525,41 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		return StartIndex;
 	}
 
+	int32 FGraph::InsertEdges(const TArray<uint64>& InEdges, const TArray<int32>& InUnionSizes, const int32 InIOIndex)
+	{
+		check(InEdges.Num() == InUnionSizes.Num())
+
+		FWriteScopeLock WriteLock(GraphLock);
+
+		const int32 StartIndex = InsertEdges_Unsafe(TArray<TConstArrayView<uint64>>{TConstArrayView<uint64>(InEdges)}, InIOIndex);
+		const int32 EndIndex = Edges.Num();
+
+		if (StartIndex == EndIndex) { return StartIndex; }
+
+		FWriteScopeLock WriteMetadataLock(EdgeMetadataLock);
+		EdgeMetadata.Reserve(EdgeMetadata.Num() + EndIndex - StartIndex);
+
+		// New edges are laid out in order of first occurrence, so a single forward walk matches them with their entry
+		int32 NextEdge = StartIndex;
+		for (int i = 0; i < InEdges.Num() && NextEdge < EndIndex; i++)
+		{
+			if (Edges[NextEdge].H64U() != InEdges[i]) { continue; }
+			GetOrCreateEdgeMetadata_Unsafe(NextEdge).UnionSize = InUnionSizes[i];
+			NextEdge++;
+		}
+
+		return StartIndex;
+	}
+
 	void FGraph::InsertEdges_Unsafe(const TSet<uint64>& InEdges, const int32 InIOIndex)
 	{
+		if (InEdges.Num() > PCGExMT::CompactionScopeSize)
+		{
+			const TArray<uint64> FlatEdges = InEdges.Array();
+			InsertEdges_Unsafe(TArray<TConstArrayView<uint64>>{TConstArrayView<uint64>(FlatEdges)}, InIOIndex);
+			return;
+		}
+
 		uint32 A;
 		uint32 B;
 		for (const uint64& E : InEdges)
@@ -413,6 +584,229 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		InsertEdges_Unsafe(InEdges, InIOIndex);
 	}
 
+	int32 FGraph::InsertEdges_Unsafe(const TArray<TConstArrayView<uint64>>& InEdgeBatches, const int32 InIOIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Bulk);
+
+		const int32 StartIndex = Edges.Num();
+
+		int32 NumHashes = 0;
+		TArray<int32> BatchOffsets;
+		BatchOffsets.SetNumUninitialized(InEdgeBatches.Num());
+		for (int i = 0; i < InEdgeBatches.Num(); i++)
+		{
+			BatchOffsets[i] = NumHashes;
+			NumHashes += InEdgeBatches[i].Num();
+		}
+
+		if (!NumHashes) { return StartIndex; }
+
+		if (NumHashes <= PCGExMT::CompactionScopeSize)
+		{
+			uint32 A;
+			uint32 B;
+
+			for (const TConstArrayView<uint64>& Batch : InEdgeBatches)
+			{
+				for (const uint64 E : Batch)
+				{
+					if (UniqueEdges.Contains(E)) { continue; }
+
+					PCGEx::H64(E, A, B);
+
+					check(A != B)
+
+					const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B, -1, InIOIndex);
+					UniqueEdges.Add(E, EdgeIndex);
+					Nodes[A].LinkEdge(EdgeIndex);
+					Nodes[B].LinkEdge(EdgeIndex);
+				}
+			}
+
+			return StartIndex;
+		}
+
+		// Flatten batches, unless there is only one
+
+		TArray<uint64> FlatHashes;
+		const uint64* Hashes = nullptr;
+
+		if (InEdgeBatches.Num() == 1) { Hashes = InEdgeBatches[0].GetData(); }
+		else
+		{
+			FlatHashes.SetNumUninitialized(NumHashes);
+			PCGExMT::ParallelForBlocking(
+				InEdgeBatches.Num(), [&](const int32 i)
+				{
+					const TConstArrayView<uint64>& Batch = InEdgeBatches[i];
+					if (!Batch.IsEmpty()) { FMemory::Memcpy(FlatHashes.GetData() + BatchOffsets[i], Batch.GetData(), Batch.Num() * sizeof(uint64)); }
+				});
+			Hashes = FlatHashes.GetData();
+		}
+
+		TArray<PCGExMT::FScope> Scopes;
+		PCGExMT::SubLoopScopes(Scopes, NumHashes, PCGExMT::CompactionScopeSize);
+
+		// Concurrent dedup against the graph and within the batch.
+		// Each new hash keeps the position of its first occurrence, so the outcome matches a serial insertion.
+
+		const uint32 TableSize = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(NumHashes) * 2);
+		const uint32 TableMask = TableSize - 1;
+
+		TArray<uint64> TableKeys;
+		TArray<int32> TableFirst;
+		TableKeys.SetNumZeroed(TableSize);
+		TableFirst.Init(MAX_int32, TableSize);
+
+		TArray<int32> Slots;
+		Slots.SetNumUninitialized(NumHashes);
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Bulk::Dedup);
+
+			PCGExMT::ParallelForBlocking(
+				Scopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const uint64 Hash = Hashes[i];
+
+						if (UniqueEdges.Contains(Hash))
+						{
+							Slots[i] = -1;
+							continue;
+						}
+
+						uint32 Slot = static_cast<uint32>(Hash * 0x9E3779B97F4A7C15ull >> 32) & TableMask;
+						while (true)
+						{
+							const int64 Prev = FPlatformAtomics::InterlockedCompareExchange(reinterpret_cast<volatile int64*>(&TableKeys[Slot]), static_cast<int64>(Hash), 0);
+							if (Prev == 0 || static_cast<uint64>(Prev) == Hash) { break; }
+							Slot = (Slot + 1) & TableMask;
+						}
+
+						Slots[i] = Slot;
+
+						int32 First = FPlatformAtomics::AtomicRead(&TableFirst[Slot]);
+						while (i < First)
+						{
+							const int32 Prev = FPlatformAtomics::InterlockedCompareExchange(&TableFirst[Slot], i, First);
+							if (Prev == First) { break; }
+							First = Prev;
+						}
+					}
+				});
+		}
+
+		TArray<int32> ReadIndices;
+		const int32 NumNew = PCGExMT::GetCompactionIndices(ReadIndices, NumHashes, [&](const int32 i) { return Slots[i] != -1 && TableFirst[Slots[i]] == i; });
+
+		if (!NumNew) { return StartIndex; }
+
+		TableKeys.Empty();
+		TableFirst.Empty();
+		Slots.Empty();
+
+		// Reserve edge indices & write edges
+
+		TArray<PCGExMT::FScope> EdgeScopes;
+		const bool bInlineEdges = PCGExMT::SubLoopScopes(EdgeScopes, NumNew, PCGExMT::CompactionScopeSize) <= 1;
+
+		Edges.SetNumUninitialized(StartIndex + NumNew);
+		UniqueEdges.Reserve(UniqueEdges.Num() + NumNew);
+
+		const int32 NumNodes = Nodes.Num();
+
+		TArray<int32> LinkCounts;
+		LinkCounts.SetNumZeroed(NumNodes);
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Bulk::Edges);
+
+			PCGExMT::ParallelForBlocking(
+				EdgeScopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = EdgeScopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const uint64 Hash = Hashes[ReadIndices[i]];
+						const int32 EdgeIndex = StartIndex + i;
+
+						uint32 A;
+						uint32 B;
+						PCGEx::H64(Hash, A, B);
+
+						check(A != B)
+
+						Edges[EdgeIndex] = FEdge(EdgeIndex, A, B, -1, InIOIndex);
+						UniqueEdges.Add_Concurrent(Hash, EdgeIndex);
+
+						FPlatformAtomics::InterlockedIncrement(&LinkCounts[A]);
+						FPlatformAtomics::InterlockedIncrement(&LinkCounts[B]);
+					}
+				}, bInlineEdges);
+		}
+
+		// Link fill : grow each node once, scatter, then restore insertion order
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Bulk::Links);
+
+			TArray<PCGExMT::FScope> NodeScopes;
+			const bool bInlineNodes = PCGExMT::SubLoopScopes(NodeScopes, NumNodes, PCGExMT::CompactionScopeSize) <= 1;
+
+			TArray<int32> LinkCursors;
+			LinkCursors.SetNumUninitialized(NumNodes);
+
+			PCGExMT::ParallelForBlocking(
+				NodeScopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = NodeScopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						TArray<FLink>& Links = Nodes[i].Links;
+						LinkCursors[i] = Links.Num();
+						if (LinkCounts[i]) { Links.SetNumUninitialized(Links.Num() + LinkCounts[i]); }
+					}
+				}, bInlineNodes);
+
+			PCGExMT::ParallelForBlocking(
+				EdgeScopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = EdgeScopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const FEdge& Edge = Edges[StartIndex + i];
+						Nodes[Edge.Start].Links[FPlatformAtomics::InterlockedIncrement(&LinkCursors[Edge.Start]) - 1] = FLink(0, Edge.Index);
+						Nodes[Edge.End].Links[FPlatformAtomics::InterlockedIncrement(&LinkCursors[Edge.End]) - 1] = FLink(0, Edge.Index);
+					}
+				}, bInlineEdges);
+
+			PCGExMT::ParallelForBlocking(
+				NodeScopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = NodeScopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const int32 Count = LinkCounts[i];
+						if (Count <= 1) { continue; }
+
+						TArray<FLink>& Links = Nodes[i].Links;
+						Algo::Sort(TArrayView<FLink>(Links.GetData() + Links.Num() - Count, Count), [](const FLink& L, const FLink& R) { return L.Edge < R.Edge; });
+					}
+				}, bInlineNodes);
+		}
+
+		return StartIndex;
+	}
+
+	int32 FGraph::InsertEdges(const TArray<TConstArrayView<uint64>>& InEdgeBatches, const int32 InIOIndex)
+	{
+		FWriteScopeLock WriteLock(GraphLock);
+		return InsertEdges_Unsafe(InEdgeBatches, InIOIndex);
+	}
+
 	TArrayView<FNode> FGraph::AddNodes(const int32 NumNewNodes)
 	{
 		const int32 StartIndex = Nodes.Num();
@@ -432,71 +826,246 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+
+		if (!NumNodes || !NumEdges) { return; }
 
-		int32 VisitedNum = 0;
+		TArray<PCGExMT::FScope> NodeScopes;
+		TArray<PCGExMT::FScope> EdgeScopes;
+		const bool bInlineNodes = PCGExMT::SubLoopScopes(NodeScopes, NumNodes, PCGExMT::CompactionScopeSize) <= 1;
+		const bool bInlineEdges = PCGExMT::SubLoopScopes(EdgeScopes, NumEdges, PCGExMT::CompactionScopeSize) <= 1;
 
-		for (int i = 0; i < Nodes.Num(); i++)
+		// An edge is exported if it and both its endpoints are still valid
+		auto IsExported = [&](const FEdge& Edge) { return Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid; };
+
+		// Lock-free union-find over exported edges.
+		// Roots always link toward the smaller index, so parents only ever decrease and each component ends up labelled by its first node.
+
+		TArray<int32> Labels;
+		Labels.SetNumUninitialized(NumNodes);
+
+		PCGExMT::ParallelForBlocking(
+			NodeScopes.Num(), [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = NodeScopes[ScopeIndex];
+				for (int i = Scope.Start; i < Scope.End; i++) { Labels[i] = i; }
+			}, bInlineNodes);
+
+		auto FindRoot = [&](int32 Index)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			while (true)
+			{
+				const int32 Parent = FPlatformAtomics::AtomicRead(&Labels[Index]);
+				if (Parent == Index) { return Index; }
+
+				// Path halving ; losing the exchange is harmless since any ancestor is a valid shortcut
+				const int32 GrandParent = FPlatformAtomics::AtomicRead(&Labels[Parent]);
+				if (GrandParent != Parent) { FPlatformAtomics::InterlockedCompareExchange(&Labels[Index], GrandParent, Parent); }
+				Index = GrandParent;
+			}
+		};
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Union);
+
+			PCGExMT::ParallelForBlocking(
+				EdgeScopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = EdgeScopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const FEdge& Edge = Edges[i];
+						if (!IsExported(Edge)) { continue; }
 
-			if (VisitedNodes[i]) { continue; }
+						int32 A = Edge.Start;
+						int32 B = Edge.End;
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+						while (true)
+						{
+							A = FindRoot(A);
+							B = FindRoot(B);
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty()) { continue; }
+							if (A == B) { break; }
+							if (A < B) { Swap(A, B); }
 
-			PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
-			SubGraph->WeakParentGraph = SharedThis(this);
+							// Only succeeds if A is still a root, otherwise walk up again
+							if (FPlatformAtomics::InterlockedCompareExchange(&Labels[A], B, A) == A) { break; }
+						}
+					}
+				}, bInlineEdges);
+		}
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+		// Flatten labels & count exported edges per node
 
-			while (Stack.Num() > 0)
+		PCGExMT::ParallelForBlocking(
+			NodeScopes.Num(), [&](const int32 ScopeIndex)
 			{
-#if PCGEX_ENGINE_VERSION <= 503
-				const int32 NextIndex = Stack.Pop(false);
-#else
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-#endif
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink Lk : Node.Links)
+				const PCGExMT::FScope& Scope = NodeScopes[ScopeIndex];
+				for (int i = Scope.Start; i < Scope.End; i++)
 				{
-					const int32 E = Lk.Edge;
+					// Other threads may still be walking & halving through this label
+					FPlatformAtomics::AtomicStore(&Labels[i], FindRoot(i));
 
-					if (VisitedEdges[E]) { continue; }
-					VisitedEdges[E] = true;
+					FNode& Node = Nodes[i];
+					Node.NumExportedEdges = 0;
 
-					const FEdge& Edge = Edges[E];
+					if (!Node.bValid) { continue; }
+					for (const FLink Lk : Node.Links) { if (IsExported(Edges[Lk.Edge])) { Node.NumExportedEdges++; } }
+				}
+			}, bInlineNodes);
 
-					if (!Edge.bValid) { continue; }
+		// Nodes without exported edges are left as singletons, so roots with edges are exactly the components.
+		// Components are ordered by their first node, same as a serial traversal would find them.
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		TArray<int32> Roots;
+		const int32 NumComponents = PCGExMT::GetCompactionIndices(Roots, NumNodes, [&](const int32 i) { return Labels[i] == i && Nodes[i].NumExportedEdges > 0; });
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+		if (!NumComponents) { return; }
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
+		TArray<int32> ComponentIndices;
+		ComponentIndices.SetNumUninitialized(NumNodes);
+
+		PCGExMT::ParallelForBlocking(NumComponents, [&](const int32 i) { ComponentIndices[Roots[i]] = i; }, NumComponents <= PCGExMT::CompactionScopeSize);
+
+		// Bucket items per component : count -> prefix sum -> scatter -> sort.
+		// Runs of items sharing a component are reserved with a single atomic, so a dominant component doesn't serialize threads.
+
+		auto BucketPerComponent = [&](const TArray<PCGExMT::FScope>& Scopes, const bool bInline, auto&& GetComponent, TArray<int32>& OutOffsets, TArray<int32>& OutItems)
+		{
+			TArray<int32> Cursors;
+			Cursors.SetNumZeroed(NumComponents);
+
+			auto ForEachRun = [&](const PCGExMT::FScope& Scope, auto&& Func)
+			{
+				int32 i = Scope.Start;
+				while (i < Scope.End)
+				{
+					const int32 Component = GetComponent(i);
+					if (Component == -1)
 					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+						i++;
+						continue;
+					}
 
-						Stack.Add(OtherIndex);
+					const int32 RunStart = i;
+					int32 RunCount = 1;
+					for (i++; i < Scope.End; i++)
+					{
+						const int32 Other = GetComponent(i);
+						if (Other == -1) { continue; }
+						if (Other != Component) { break; }
+						RunCount++;
 					}
+
+					Func(Component, RunStart, RunCount);
 				}
+			};
+
+			PCGExMT::ParallelForBlocking(
+				Scopes.Num(), [&](const int32 ScopeIndex)
+				{
+					ForEachRun(
+						Scopes[ScopeIndex], [&](const int32 Component, const int32 RunStart, const int32 RunCount)
+						{
+							FPlatformAtomics::InterlockedAdd(&Cursors[Component], RunCount);
+						});
+				}, bInline);
+
+			PCGEx::InitArray(OutOffsets, NumComponents + 1);
+
+			int32 Offset = 0;
+			for (int c = 0; c < NumComponents; c++)
+			{
+				OutOffsets[c] = Offset;
+				const int32 Count = Cursors[c];
+				Cursors[c] = Offset;
+				Offset += Count;
 			}
+			OutOffsets[NumComponents] = Offset;
+
+			OutItems.SetNumUninitialized(Offset);
+
+			PCGExMT::ParallelForBlocking(
+				Scopes.Num(), [&](const int32 ScopeIndex)
+				{
+					ForEachRun(
+						Scopes[ScopeIndex], [&](const int32 Component, const int32 RunStart, const int32 RunCount)
+						{
+							int32 WriteIndex = FPlatformAtomics::InterlockedAdd(&Cursors[Component], RunCount);
+							int32 Remaining = RunCount;
+							for (int32 i = RunStart; Remaining > 0; i++)
+							{
+								if (GetComponent(i) != Component) { continue; }
+								OutItems[WriteIndex++] = i;
+								Remaining--;
+							}
+						});
+				}, bInline);
+
+			// Scatter order depends on scheduling, restore ascending order within each component
+			PCGExMT::ParallelForBlocking(
+				NumComponents, [&](const int32 c)
+				{
+					const int32 Start = OutOffsets[c];
+					const int32 Count = OutOffsets[c + 1] - Start;
+					if (Count > 1) { Algo::Sort(TArrayView<int32>(OutItems.GetData() + Start, Count)); }
+				}, bInline);
+		};
+
+		TArray<int32> NodeOffsets;
+		TArray<int32> ComponentNodes;
+		TArray<int32> EdgeOffsets;
+		TArray<int32> ComponentEdges;
 
-			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); } // Will invalidate isolated points
-			else if (!SubGraph->Edges.IsEmpty()) { SubGraphs.Add(SubGraph.ToSharedRef()); }
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Bucket);
+
+			BucketPerComponent(
+				NodeScopes, bInlineNodes, [&](const int32 i)
+				{
+					return Nodes[i].NumExportedEdges > 0 ? ComponentIndices[Labels[i]] : -1;
+				}, NodeOffsets, ComponentNodes);
+
+			BucketPerComponent(
+				EdgeScopes, bInlineEdges, [&](const int32 i)
+				{
+					const FEdge& Edge = Edges[i];
+					return IsExported(Edge) ? ComponentIndices[Labels[Edge.Start]] : -1;
+				}, EdgeOffsets, ComponentEdges);
 		}
+
+		// Create subgraphs & check limits per component.
+		// Invalidation only touches the component's own nodes & edges, which makes it safe to run concurrently.
+
+		TArray<TSharedPtr<FSubGraph>> ValidSubGraphs;
+		ValidSubGraphs.SetNum(NumComponents);
+
+		const TSharedPtr<FGraph> ThisGraph = SharedThis(this);
+
+		PCGExMT::ParallelForBlocking(
+			NumComponents, [&](const int32 c)
+			{
+				PCGEX_MAKE_SHARED(SubGraph, FSubGraph)
+				SubGraph->WeakParentGraph = ThisGraph;
+
+				SubGraph->Nodes.Reserve(NodeOffsets[c + 1] - NodeOffsets[c]);
+				for (int i = NodeOffsets[c]; i < NodeOffsets[c + 1]; i++) { SubGraph->Nodes.Add(ComponentNodes[i]); }
+
+				SubGraph->Edges.Reserve(EdgeOffsets[c + 1] - EdgeOffsets[c]);
+				for (int i = EdgeOffsets[c]; i < EdgeOffsets[c + 1]; i++)
+				{
+					const FEdge& Edge = Edges[ComponentEdges[i]];
+					SubGraph->Edges.Add(Edge.Index);
+					if (Edge.IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(Edge.IOIndex); }
+				}
+
+				if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); }
+				else { ValidSubGraphs[c] = SubGraph; }
+			}, NumComponents <= 1);
+
+		SubGraphs.Reserve(SubGraphs.Num() + NumComponents);
+		for (const TSharedPtr<FSubGraph>& SubGraph : ValidSubGraphs) { if (SubGraph) { SubGraphs.Add(SubGraph.ToSharedRef()); } }
 	}
 
 	void FGraph::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const
@@ -555,86 +1124,147 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 		TArray<FNode>& Nodes = Graph->Nodes;
 
+		TArray<int32> ValidNodes;
+		TArray<PCGExMT::FScope> Scopes;
 
-		TArray<int32> InternalValidNodes;
-		TArray<int32>& ValidNodes = InternalValidNodes;
-		TArray<PCGEx::TOrder<FVector>> Order;
-
-		int32 NumNodes = Nodes.Num();
-
-		if (OutputNodeIndices) { ValidNodes = *OutputNodeIndices; }
-
-		ValidNodes.Reserve(NumNodes);
-		Order.Reserve(NumNodes);
+		int32 NumNodes = 0;
+		bool bInline = true;
 
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::PrunePoints);
 
-			UPCGMetadata* OutPointsMetadata = NodeDataFacade->Source->GetOut()->Metadata;
-
 			// Rebuild point list with only the one used
 			// to know which are used, we need to prune subgraphs first
+			// Points are either filled before, or pulled from the input
 			TArray<FPCGPoint>& MutablePoints = NodeDataFacade->GetOut()->GetMutablePoints();
+			const TArray<FPCGPoint>& SourcePoints = MutablePoints.IsEmpty() ? NodeDataFacade->GetIn()->GetPoints() : MutablePoints;
 
-			if (!MutablePoints.IsEmpty())
-			{
-				//Assume points were filled before, and remove them from the current array
-				TArray<FPCGPoint> PrunedPoints;
-				PrunedPoints.Reserve(MutablePoints.Num());
-
-				for (FNode& Node : Nodes)
+			NumNodes = PCGExMT::GetCompactionIndices(
+				ValidNodes, Nodes.Num(), [&](const int32 i)
 				{
-					if (!Node.bValid || Node.IsEmpty()) { continue; }
-					Node.PointIndex = PrunedPoints.Add(MutablePoints[Node.PointIndex]);
+					const FNode& Node = Nodes[i];
+					return Node.bValid && !Node.IsEmpty();
+				});
 
-					Order.Emplace(ValidNodes.Add(Node.Index), MutablePoints[Node.PointIndex].Transform.GetLocation());
-				}
+			bInline = PCGExMT::SubLoopScopes(Scopes, NumNodes, PCGExMT::CompactionScopeSize) <= 1;
+
+			// Order[i] is the index in ValidNodes of the node that ends up as point i
+			TArray<int32> Order;
+			PCGEx::ArrayOfIndices(Order, NumNodes);
 
-				NodeDataFacade->GetOut()->SetPoints(PrunedPoints);
-				//TArray<FPCGPoint>& ValidPoints = NodeDataFacade->GetOut()->GetMutablePoints();
-				//for (FPCGPoint& ValidPoint : ValidPoints) { OutPointsMetadata->InitializeOnSet(ValidPoint.MetadataEntry); }
-			}
-			else
 			{
-				MutablePoints.Reserve(NumNodes);
+				TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::SortPoints);
 
-				const TArray<FPCGPoint> OriginalPoints = NodeDataFacade->GetIn()->GetPoints();
+				auto GetPosition = [&](const int32 i) { return SourcePoints[Nodes[ValidNodes[i]].PointIndex].Transform.GetLocation(); };
 
-				for (FNode& Node : Nodes)
+				TArray<FBox> ScopeBounds;
+				ScopeBounds.Init(FBox(ForceInit), Scopes.Num());
+
+				PCGExMT::ParallelForBlocking(
+					Scopes.Num(), [&](const int32 ScopeIndex)
+					{
+						const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+						FBox& Box = ScopeBounds[ScopeIndex];
+						for (int i = Scope.Start; i < Scope.End; i++) { Box += GetPosition(i); }
+					}, bInline);
+
+				FBox Bounds(ForceInit);
+				for (const FBox& Box : ScopeBounds) { Bounds += Box; }
+
+				// Quantize positions over 21 bits per axis so they fit in a single radix key
+				constexpr int64 MaxQuantized = (1 << 21) - 1;
+				const FVector Size = Bounds.GetSize();
+				const FVector Scale(
+					Size.X > 0 ? MaxQuantized / Size.X : 0,
+					Size.Y > 0 ? MaxQuantized / Size.Y : 0,
+					Size.Z > 0 ? MaxQuantized / Size.Z : 0);
+
+				const bool bMorton = GetDefault<UPCGExGlobalSettings>()->VtxSpatialOrder == EPCGExVtxSpatialOrder::Morton;
+
+				auto SpreadBits = [](uint64 V)
 				{
-					if (!Node.bValid || Node.IsEmpty()) { continue; }
-					Node.PointIndex = MutablePoints.Add(OriginalPoints[Node.PointIndex]);
-					//OutPointsMetadata->InitializeOnSet(MutablePoints.Last().MetadataEntry);
+					V &= 0x1FFFFF;
+					V = (V | V << 32) & 0x1F00000000FFFF;
+					V = (V | V << 16) & 0x1F0000FF0000FF;
+					V = (V | V << 8) & 0x100F00F00F00F00F;
+					V = (V | V << 4) & 0x10C30C30C30C30C3;
+					V = (V | V << 2) & 0x1249249249249249;
+					return V;
+				};
+
+				TArray<uint64> SortKeys;
+				SortKeys.SetNumUninitialized(NumNodes);
+
+				PCGExMT::ParallelForBlocking(
+					Scopes.Num(), [&](const int32 ScopeIndex)
+					{
+						const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+						for (int i = Scope.Start; i < Scope.End; i++)
+						{
+							const FVector Q = (GetPosition(i) - Bounds.Min) * Scale;
+							const uint64 X = FMath::Clamp<int64>(FMath::FloorToInt64(Q.X), 0, MaxQuantized);
+							const uint64 Y = FMath::Clamp<int64>(FMath::FloorToInt64(Q.Y), 0, MaxQuantized);
+							const uint64 Z = FMath::Clamp<int64>(FMath::FloorToInt64(Q.Z), 0, MaxQuantized);
+
+							SortKeys[i] = bMorton ?
+								              (SpreadBits(X) << 2) | (SpreadBits(Y) << 1) | SpreadBits(Z) :
+								              (X << 42) | (Y << 21) | Z;
+						}
+					}, bInline);
 
-					Order.Emplace(ValidNodes.Add(Node.Index), MutablePoints[Node.PointIndex].Transform.GetLocation());
-				}
+				// Stable, so vtx sharing a key stay in node order and the output is deterministic
+				PCGExMT::RadixSort(SortKeys, Order);
 			}
 
-			ValidNodes.Shrink();
-			Order.Shrink();
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::GatherPoints);
 
-			NumNodes = ValidNodes.Num();
+				TArray<FPCGPoint> SortedPoints;
+				SortedPoints.SetNum(NumNodes);
 
-			{
-				TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::SortPoints);
+				TArray<int32> SortedNodes;
+				SortedNodes.SetNumUninitialized(NumNodes);
 
-				Order.Sort(
-					[](const PCGEx::TOrder<FVector>& A, const PCGEx::TOrder<FVector>& B)
+				PCGExMT::ParallelForBlocking(
+					Scopes.Num(), [&](const int32 ScopeIndex)
 					{
-						if (A.Det.X != B.Det.X) { return A.Det.X < B.Det.X; }
-						if (A.Det.Y != B.Det.Y) { return A.Det.Y < B.Det.Y; }
-						return A.Det.Z < B.Det.Z;
-					});
+						const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+						for (int i = Scope.Start; i < Scope.End; i++)
+						{
+							const int32 NodeIndex = ValidNodes[Order[i]];
+							FNode& Node = Nodes[NodeIndex];
+
+							SortedNodes[i] = NodeIndex;
+							SortedPoints[i] = SourcePoints[Node.PointIndex];
+							Node.PointIndex = i;
+						}
+					}, bInline);
+
+				MutablePoints = MoveTemp(SortedPoints);
+				ValidNodes = MoveTemp(SortedNodes);
 
-				// Reorder output points
-				ReorderArray(MutablePoints, Order);
 				// Reorder output indices if provided
 				// Needed for delaunay etc that rely on original indices to identify sites etc
-				if (OutputPointIndices && OutputPointIndices->Num() == MutablePoints.Num()) { ReorderArray(*OutputPointIndices, Order); }
+				if (OutputPointIndices && OutputPointIndices->Num() == NumNodes)
+				{
+					TArray<int32> SortedIndices;
+					SortedIndices.SetNumUninitialized(NumNodes);
+
+					const TArray<int32>& Indices = *OutputPointIndices;
+					PCGExMT::ParallelForBlocking(
+						Scopes.Num(), [&](const int32 ScopeIndex)
+						{
+							const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+							for (int i = Scope.Start; i < Scope.End; i++) { SortedIndices[i] = Indices[Order[i]]; }
+						}, bInline);
+
+					*OutputPointIndices = MoveTemp(SortedIndices);
+				}
 			}
 		}
 
-		// Sort points & update node PointIndex
+		// Output node index for each vtx point
+		if (OutputNodeIndices) { *OutputNodeIndices = ValidNodes; }
 
 		const TSharedPtr<PCGExData::TBuffer<int64>> VtxEndpointWriter = NodeDataFacade->GetWritable<int64>(Attr_PCGExVtxIdx, 0, false, PCGExData::EBufferInit::New);
 
@@ -643,12 +1273,16 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::RemapNodes);
 
-			for (int i = 0; i < NumNodes; i++)
-			{
-				FNode& Node = Nodes[ValidNodes[Order[i].Index]];
-				Node.PointIndex = i;
-				VtxEndpointWriter->GetMutable(Node.PointIndex) = PCGEx::H64(NodeGUID(BaseGUID, Node.PointIndex), Node.NumExportedEdges);
-			}
+			PCGExMT::ParallelForBlocking(
+				Scopes.Num(), [&](const int32 ScopeIndex)
+				{
+					const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						const FNode& Node = Nodes[ValidNodes[i]];
+						VtxEndpointWriter->GetMutable(Node.PointIndex) = PCGEx::H64(NodeGUID(BaseGUID, Node.PointIndex), Node.NumExportedEdges);
+					}
+				}, bInline);
 		}
 
 		if (MetadataDetails && !Graph->NodeMetadata.IsEmpty())
@@ -460,8 +460,7 @@ namespace PCGExGraph
 		const int32 StartIndex = MutablePoints.Num();
 		MutablePoints.SetNum(Graph->Nodes.Num());
 
-		UPCGMetadata* Metadata = PointIO->GetOut()->Metadata;
-		for (int i = StartIndex; i < MutablePoints.Num(); i++) { Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry); }
+		PointIO->InitPoints(StartIndex);
 
 		return true;
 	}
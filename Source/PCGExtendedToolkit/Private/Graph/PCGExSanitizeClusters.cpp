@@ -3,6 +3,8 @@
 
 #include "Graph/PCGExSanitizeClusters.h"
 
+#include "PCGExRandom.h"
+
 
 #define LOCTEXT_NAMESPACE "PCGExGraphSettings"
 
@@ -64,23 +66,190 @@ namespace PCGExSanitizeClusters
 
 		if (!FClusterProcessor::Process(InAsyncManager)) { return false; }
 
-		TArray<PCGExGraph::FEdge> IndexedEdges;
-
 		BuildIndexedEdges(EdgeDataFacade->Source, *EndpointsLookup, IndexedEdges);
-		if (!IndexedEdges.IsEmpty()) { GraphBuilder->Graph->InsertEdges(IndexedEdges); }
+		bIsClean = CheckIsClean();
 
 		EdgeDataFacade->Source->CleanupKeys();
 
 		return true;
 	}
 
+	bool FProcessor::CheckIsClean()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSanitizeClusters::CheckIsClean);
+
+		// Edges with unresolved endpoints have already been dropped
+		const int32 NumEdges = IndexedEdges.Num();
+		if (!NumEdges || NumEdges != EdgeDataFacade->GetNum()) { return false; }
+
+		TArray<int32>& Owners = *VtxOwners;
+		TArray<int32>& Degrees = *VtxDegrees;
+		TArray<int32>& Labels = *VtxLabels;
+
+		// Vtx are only ever touched by the edge set that owns them, so the union-find doesn't need to be atomic
+		auto FindRoot = [&](int32 Index)
+		{
+			while (Labels[Index] != Index)
+			{
+				Labels[Index] = Labels[Labels[Index]];
+				Index = Labels[Index];
+			}
+			return Index;
+		};
+
+		TArray<uint64> EdgeHashes;
+		EdgeHashes.SetNumUninitialized(NumEdges);
+
+		int32 NumVtx = 0;
+		int32 NumComponents = 0;
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const PCGExGraph::FEdge& Edge = IndexedEdges[i];
+			if (Edge.Start == Edge.End) { return false; }
+
+			for (const int32 PointIndex : {Edge.Start, Edge.End})
+			{
+				// A vtx claimed by another edge set means the two clusters must be merged
+				const int32 Owner = FPlatformAtomics::InterlockedCompareExchange(&Owners[PointIndex], BatchIndex, -1);
+				if (Owner == -1)
+				{
+					NumVtx++;
+					NumComponents++;
+				}
+				else if (Owner != BatchIndex) { return false; }
+
+				Degrees[PointIndex]++;
+			}
+
+			const int32 A = FindRoot(Edge.Start);
+			const int32 B = FindRoot(Edge.End);
+			if (A != B)
+			{
+				Labels[FMath::Max(A, B)] = FMath::Min(A, B);
+				NumComponents--;
+			}
+
+			EdgeHashes[i] = PCGEx::H64U(Edge.Start, Edge.End);
+		}
+
+		if (NumComponents != 1) { return false; }
+		if (!Context->GraphBuilderDetails.IsValid(NumVtx, NumEdges)) { return false; }
+
+		EdgeHashes.Sort();
+		for (int i = 1; i < NumEdges; i++) { if (EdgeHashes[i] == EdgeHashes[i - 1]) { return false; } }
+
+		return true;
+	}
+
+	void FProcessor::ForwardEdges(const FPCGExGraphBuilderDetails& InDetails) const
+	{
+		const TSharedPtr<PCGExData::FPointIO>& EdgesIO = EdgeDataFacade->Source;
+
+		if (!InDetails.bWriteEdgePosition && !InDetails.bRefreshEdgeSeed)
+		{
+			EdgesIO->InitializeOutput(PCGExData::EIOInit::Forward);
+			EdgesIO->StageOutput();
+			return;
+		}
+
+		EdgesIO->InitializeOutput(PCGExData::EIOInit::Duplicate);
+
+		const TArray<FPCGPoint>& Vertices = VtxDataFacade->GetIn()->GetPoints();
+		TArray<FPCGPoint>& MutablePoints = EdgesIO->GetOut()->GetMutablePoints();
+		const FVector SeedOffset = FVector(EdgesIO->IOIndex);
+
+		// Same per-edge output as a graph compilation, minus the rebuild
+		PCGExMT::ParallelForBlocking(
+			IndexedEdges.Num(), [&](const int32 i)
+			{
+				const PCGExGraph::FEdge& Edge = IndexedEdges[i];
+				FPCGPoint& EdgePt = MutablePoints[Edge.PointIndex];
+
+				if (InDetails.bWriteEdgePosition) { InDetails.BasicEdgeSolidification.Mutate(EdgePt, Vertices[Edge.Start], Vertices[Edge.End], InDetails.EdgePosition); }
+				if (EdgePt.Seed == 0 || InDetails.bRefreshEdgeSeed) { EdgePt.Seed = PCGExRandom::ComputeSeed(EdgePt, SeedOffset); }
+			});
+
+		EdgesIO->StageOutput();
+	}
+
+	void FBatch::Process()
+	{
+		const int32 NumVtx = VtxDataFacade->GetNum();
+
+		VtxOwners = MakeShared<TArray<int32>>();
+		VtxOwners->Init(-1, NumVtx);
+
+		VtxDegrees = MakeShared<TArray<int32>>();
+		VtxDegrees->Init(0, NumVtx);
+
+		VtxLabels = MakeShared<TArray<int32>>();
+		PCGEx::ArrayOfIndices(*VtxLabels, NumVtx);
+
+		TBatchWithGraphBuilder<FProcessor>::Process();
+	}
+
+	bool FBatch::PrepareSingle(const TSharedPtr<FProcessor>& ClusterProcessor)
+	{
+		ClusterProcessor->VtxOwners = VtxOwners;
+		ClusterProcessor->VtxDegrees = VtxDegrees;
+		ClusterProcessor->VtxLabels = VtxLabels;
+		return TBatchWithGraphBuilder<FProcessor>::PrepareSingle(ClusterProcessor);
+	}
+
 	void FBatch::CompleteWork()
 	{
+		// Already clean clusters are forwarded as-is and skip the graph builder entirely.
+		// That requires every edge set to be clean on its own, and every vtx to be used with its stored adjacency.
+
+		bForwardClean = !Processors.IsEmpty() && Processors.Num() == Edges.Num();
+		for (const TSharedRef<FProcessor>& P : Processors)
+		{
+			if (!P->bIsProcessorValid || !P->bIsClean)
+			{
+				bForwardClean = false;
+				break;
+			}
+		}
+
+		if (bForwardClean)
+		{
+			const TArray<int32>& Owners = *VtxOwners;
+			const TArray<int32>& Degrees = *VtxDegrees;
+
+			for (int i = 0; i < Owners.Num(); i++)
+			{
+				if (Owners[i] == -1 || Degrees[i] != ExpectedAdjacency[i])
+				{
+					bForwardClean = false;
+					break;
+				}
+			}
+		}
+
+		VtxOwners.Reset();
+		VtxDegrees.Reset();
+		VtxLabels.Reset();
+
+		if (bForwardClean) { return; }
+
+		for (const TSharedRef<FProcessor>& P : Processors)
+		{
+			if (!P->IndexedEdges.IsEmpty()) { GraphBuilder->Graph->InsertEdges(P->IndexedEdges); }
+			P->IndexedEdges.Empty();
+		}
+
 		GraphBuilder->Compile(AsyncManager, true);
 	}
 
 	void FBatch::Output()
 	{
+		if (bForwardClean)
+		{
+			for (const TSharedRef<FProcessor>& P : Processors) { P->ForwardEdges(GraphBuilderDetails); }
+			return;
+		}
+
 		if (GraphBuilder->bCompiledSuccessfully) { GraphBuilder->StageEdgesOutputs(); }
 		else { GraphBuilder->NodeDataFacade->Source->InitializeOutput(PCGExData::EIOInit::None); }
 	}
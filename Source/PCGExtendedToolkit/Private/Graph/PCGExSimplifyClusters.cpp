@@ -75,45 +75,58 @@ namespace PCGExSimplifyClusters
 	}
 
 
-	void FProcessor::CompleteWork()
+	template <typename FEmitFunc>
+	void FProcessor::ForEachSimplifiedEdge(const PCGExCluster::FNodeChain& Chain, FEmitFunc&& Emit) const
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSimplifyClusters::FProcessor::CompleteWork);
-		StartParallelLoopForRange(ChainBuilder->Chains.Num());
-	}
+		if (Settings->bPruneLeaves && Chain.bIsLeaf) { return; } // Skip leaf
 
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
-	{
-		const TSharedPtr<PCGExCluster::FNodeChain> Chain = ChainBuilder->Chains[Iteration];
-		if (!Chain) { return; }
+		if (Settings->bOperateOnLeavesOnly && !Chain.bIsLeaf)
+		{
+			// Keep chain edges as-is
+			if (Chain.SingleEdge != -1)
+			{
+				const PCGExGraph::FEdge* Edge = Cluster->GetEdge(Chain.Seed.Edge);
+				Emit(Edge->Start, Edge->End, 1);
+				return;
+			}
 
-		if (Settings->bPruneLeaves && Chain->bIsLeaf) { return; } // Skip leaf
+			if (Chain.bIsClosedLoop)
+			{
+				const PCGExGraph::FEdge* Edge = Cluster->GetEdge(Chain.Seed.Edge);
+				Emit(Edge->Start, Edge->End, 1);
+			}
+
+			for (const PCGExGraph::FLink Lk : ChainBuilder->GetLinks(Chain))
+			{
+				const PCGExGraph::FEdge* Edge = Cluster->GetEdge(Lk.Edge);
+				Emit(Edge->Start, Edge->End, 1);
+			}
 
-		const bool bComputeMeta = Settings->EdgeUnionData.WriteAny();
+			return;
+		}
 
-		if (Settings->bOperateOnLeavesOnly && !Chain->bIsLeaf)
+		if (Chain.SingleEdge != -1)
 		{
-			Chain->Dump(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
+			const PCGExGraph::FEdge* Edge = Cluster->GetEdge(Chain.SingleEdge);
+			Emit(Edge->Start, Edge->End, 1);
 			return;
 		}
 
-		if (Chain->SingleEdge != -1 || !Settings->bMergeAboveAngularThreshold)
+		if (!Settings->bMergeAboveAngularThreshold)
 		{
-			Chain->DumpReduced(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
+			Emit(Cluster->GetNode(Chain.Seed)->PointIndex, Cluster->GetNode(ChainBuilder->GetLastLink(Chain))->PointIndex, Chain.NumLinks);
 			return;
 		}
 
 		const double DotThreshold = PCGExMath::DegreesToDot(Settings->AngularThreshold);
-		const int32 IOIndex = EdgeDataFacade->Source->IOIndex;
-
-		PCGExGraph::FEdge OutEdge = PCGExGraph::FEdge{};
 
-		const TArray<PCGExGraph::FLink>& Links = Chain->Links;
+		const TConstArrayView<PCGExGraph::FLink> Links = ChainBuilder->GetLinks(Chain);
 
-		int32 LastIndex = Chain->Seed.Node;
+		int32 LastIndex = Chain.Seed.Node;
 		int32 UnionCount = 0;
 
 		const int32 MaxIndex = Links.Num() - 1;
-		const int32 NumIterations = Chain->bIsClosedLoop ? Links.Num() : MaxIndex;
+		const int32 NumIterations = Chain.bIsClosedLoop ? Links.Num() : MaxIndex;
 
 		for (int i = 1; i < NumIterations; ++i)
 		{
@@ -122,37 +135,74 @@ namespace PCGExSimplifyClusters
 			const PCGExGraph::FLink Lk = Links[i];
 
 			const FVector A = Cluster->GetDir(Links[i - 1].Node, Lk.Node);
-			const FVector B = Cluster->GetDir(Lk.Node, Links[(i == MaxIndex && Chain->bIsClosedLoop) ? 0 : i + 1].Node);
+			const FVector B = Cluster->GetDir(Lk.Node, Links[(i == MaxIndex && Chain.bIsClosedLoop) ? 0 : i + 1].Node);
 
 			if (!Settings->bInvertAngularThreshold) { if (FVector::DotProduct(A, B) > DotThreshold) { continue; } }
 			else { if (FVector::DotProduct(A, B) < DotThreshold) { continue; } }
 
-			GraphBuilder->Graph->InsertEdge(
-				Cluster->GetNode(LastIndex)->PointIndex,
-				Cluster->GetNode(Lk)->PointIndex,
-				OutEdge, IOIndex);
-
-			if (bComputeMeta)
-			{
-				// TODO : Compute UnionData to carry over attributes & properties
-				GraphBuilder->Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = UnionCount;
-				UnionCount = 0;
-			}
+			// TODO : Compute UnionData to carry over attributes & properties
+			Emit(Cluster->GetNode(LastIndex)->PointIndex, Cluster->GetNode(Lk)->PointIndex, UnionCount);
+			UnionCount = 0;
 
 			LastIndex = Lk.Node;
 		}
 
 		UnionCount++;
-		GraphBuilder->Graph->InsertEdge(
-			Cluster->GetNode(LastIndex)->PointIndex,
-			Cluster->GetNode(Chain->Links.Last())->PointIndex,
-			OutEdge, IOIndex);
+		Emit(Cluster->GetNode(LastIndex)->PointIndex, Cluster->GetNode(Links.Last())->PointIndex, UnionCount);
+	}
+
+	void FProcessor::CompleteWork()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSimplifyClusters::FProcessor::CompleteWork);
+
+		const int32 NumChains = ChainBuilder->Chains.Num();
+		bComputeMeta = Settings->EdgeUnionData.WriteAny();
+
+		// Count simplified edges per chain, so each chain writes its own range of the flat buffers
+		PCGEx::InitArray(EdgeOffsets, NumChains);
+		PCGExMT::ParallelForBlocking(
+			NumChains, [&](const int32 i)
+			{
+				int32 Count = 0;
+				ForEachSimplifiedEdge(ChainBuilder->Chains[i], [&](const int32, const int32, const int32) { Count++; });
+				EdgeOffsets[i] = Count;
+			});
 
-		if (bComputeMeta)
+		int32 NumEdges = 0;
+		for (int32& Offset : EdgeOffsets)
 		{
-			// TODO : Compute UnionData to carry over attributes & properties
-			GraphBuilder->Graph->GetOrCreateEdgeMetadata(OutEdge.Index).UnionSize = UnionCount;
+			const int32 Count = Offset;
+			Offset = NumEdges;
+			NumEdges += Count;
 		}
+
+		EdgeHashes.SetNumUninitialized(NumEdges);
+		if (bComputeMeta) { EdgeUnionSizes.SetNumUninitialized(NumEdges); }
+
+		StartParallelLoopForRange(NumChains);
+	}
+
+	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
+	{
+		int32 WriteIndex = EdgeOffsets[Iteration];
+		ForEachSimplifiedEdge(
+			ChainBuilder->Chains[Iteration], [&](const int32 A, const int32 B, const int32 UnionSize)
+			{
+				EdgeHashes[WriteIndex] = PCGEx::H64U(A, B);
+				if (bComputeMeta) { EdgeUnionSizes[WriteIndex] = UnionSize; }
+				WriteIndex++;
+			});
+	}
+
+	void FProcessor::InsertSimplifiedEdges()
+	{
+		const int32 IOIndex = EdgeDataFacade->Source->IOIndex;
+		if (bComputeMeta) { GraphBuilder->Graph->InsertEdges(EdgeHashes, EdgeUnionSizes, IOIndex); }
+		else { GraphBuilder->Graph->InsertEdges(EdgeHashes, IOIndex); }
+
+		EdgeOffsets.Empty();
+		EdgeHashes.Empty();
+		EdgeUnionSizes.Empty();
 	}
 
 	const PCGExGraph::FGraphMetadataDetails* FBatch::GetGraphMetadataDetails()
@@ -180,15 +230,71 @@ namespace PCGExSimplifyClusters
 
 		if (Context->FilterFactories.IsEmpty())
 		{
-			// Process breakpoint filters
-			PCGEX_MAKE_SHARED(FilterManager, PCGExPointFilter::FManager, VtxDataFacade)
-			TArray<int8>& Breaks = *Breakpoints;
-			if (FilterManager->Init(ExecutionContext, Context->FilterFactories))
-			{
-				for (int i = 0; i < NumPoints; i++) { Breaks[i] = FilterManager->Test(i); }
-			}
+			TBatch<FProcessor>::Process();
+			return;
+		}
+
+		// Process breakpoint filters
+		BreakpointFilterManager = MakeShared<PCGExPointFilter::FManager>(VtxDataFacade);
+		if (!BreakpointFilterManager->Init(ExecutionContext, Context->FilterFactories))
+		{
+			BreakpointFilterManager.Reset();
+			TBatch<FProcessor>::Process();
+			return;
 		}
 
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, BreakpointsTaskGroup)
+
+		BreakpointsTaskGroup->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->OnBreakpointsComplete();
+			};
+
+		BreakpointsTaskGroup->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				TArray<int8>& Breaks = *This->Breakpoints;
+				for (int i = Scope.Start; i < Scope.End; i++) { Breaks[i] = This->BreakpointFilterManager->Test(i); }
+			};
+
+		BreakpointsTaskGroup->StartSubLoops(NumPoints, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FBatch::CompileGraphBuilder(const bool bOutputToContext)
+	{
+		PCGEX_CHECK_WORK_PERMIT_OR_VOID(!GraphBuilder || !bIsBatchValid)
+
+		// Processors only collect their simplified edges.
+		// They are inserted here by a single task, so the bulk insertion never has other processors waiting on the graph lock.
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, InsertEdgesTask)
+
+		InsertEdgesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, bOutputToContext]()
+			{
+				PCGEX_ASYNC_THIS
+				This->TBatch<FProcessor>::CompileGraphBuilder(bOutputToContext);
+			};
+
+		InsertEdgesTask->AddSimpleCallback(
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				for (const TSharedRef<FProcessor>& Processor : This->Processors)
+				{
+					if (Processor->bIsProcessorValid) { Processor->InsertSimplifiedEdges(); }
+				}
+			});
+
+		InsertEdgesTask->StartSimpleCallbacks();
+	}
+
+	void FBatch::OnBreakpointsComplete()
+	{
+		BreakpointFilterManager.Reset();
 		TBatch<FProcessor>::Process();
 	}
 
@@ -31,6 +31,13 @@ bool UPCGExProbeClosest::PrepareForPoints(const TSharedPtr<PCGExData::FPointIO>&
 	return true;
 }
 
+int32 UPCGExProbeClosest::GetRequiredSortedCandidates(const bool bWithCoincidence) const
+{
+	// Skipped candidates mean we may have to look further than MaxConnections
+	if (bWithCoincidence || Config.bPreventCoincidence || MaxConnectionsCache) { return -1; }
+	return MaxConnections;
+}
+
 void UPCGExProbeClosest::ProcessCandidates(const int32 Index, const FPCGPoint& Point, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges)
 {
 	bool bIsAlreadyConnected;
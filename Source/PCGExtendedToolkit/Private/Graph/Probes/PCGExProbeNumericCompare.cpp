@@ -25,6 +25,12 @@ bool UPCGExProbeNumericCompare::PrepareForPoints(const TSharedPtr<PCGExData::FPo
 	return true;
 }
 
+int32 UPCGExProbeNumericCompare::GetRequiredSortedCandidates(const bool bWithCoincidence) const
+{
+	// Every candidate within range is tested, order only matters when coincidence can reject some
+	return bWithCoincidence || Config.bPreventCoincidence ? -1 : 0;
+}
+
 void UPCGExProbeNumericCompare::ProcessCandidates(const int32 Index, const FPCGPoint& Point, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges)
 {
 	bool bIsAlreadyConnected;
@@ -34,7 +40,7 @@ void UPCGExProbeNumericCompare::ProcessCandidates(const int32 Index, const FPCGP
 
 	for (PCGExProbing::FCandidate& C : Candidates)
 	{
-		if (C.Distance > R) { return; } // Candidates are sorted, stop there.
+		if (C.Distance > R) { continue; } // Candidates may not be sorted, see GetRequiredSortedCandidates
 
 		if (Coincidence)
 		{
@@ -10,6 +10,8 @@ bool UPCGExProbeOperation::RequiresOctree() { return true; }
 
 bool UPCGExProbeOperation::RequiresChainProcessing() { return false; }
 
+int32 UPCGExProbeOperation::GetRequiredSortedCandidates(const bool bWithCoincidence) const { return -1; }
+
 bool UPCGExProbeOperation::PrepareForPoints(const TSharedPtr<PCGExData::FPointIO>& InPointIO)
 {
 	PointIO = InPointIO;
@@ -68,11 +68,25 @@ namespace PCGExFusePoints
 
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
-		UnionGraph = MakeShared<PCGExGraph::FUnionGraph>(
-			Settings->PointPointIntersectionDetails.FuseDetails,
-			PointDataFacade->GetIn()->GetBounds().ExpandBy(10));
+		FuseDetails = Settings->PointPointIntersectionDetails.FuseDetails;
+		bFuseByVoxel = FuseDetails.FuseMethod == EPCGExFuseMethod::Voxel;
+
+		if (bFuseByVoxel)
+		{
+			// Grid keys are computed independently, grouping happens in CompleteWork and doesn't depend on insertion order
+			FuseDetails.Init();
+			GridKeys.SetNumUninitialized(PointDataFacade->GetNum(PCGExData::ESource::In));
+			bInlineProcessPoints = false;
+		}
+		else
+		{
+			UnionGraph = MakeShared<PCGExGraph::FUnionGraph>(
+				Settings->PointPointIntersectionDetails.FuseDetails,
+				PointDataFacade->GetIn()->GetBounds().ExpandBy(10));
+
+			bInlineProcessPoints = FuseDetails.DoInlineInsertion();
+		}
 
-		bInlineProcessPoints = Settings->PointPointIntersectionDetails.FuseDetails.DoInlineInsertion();
 		StartParallelLoopForPoints(PCGExData::ESource::In);
 
 		return true;
@@ -80,13 +94,33 @@ namespace PCGExFusePoints
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		UnionGraph->InsertPoint(Point, PointDataFacade->Source->IOIndex, Index);
+		if (bFuseByVoxel) { GridKeys[Index] = FuseDetails.GetGridKey(Point.Transform.GetLocation()); }
+		else { UnionGraph->InsertPoint(Point, PointDataFacade->Source->IOIndex, Index); }
 	}
 
 	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
 	{
 		TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
 
+		if (bFuseByVoxel)
+		{
+			const TArray<FPCGPoint>& InPoints = PointDataFacade->GetIn()->GetPoints();
+			const PCGExMT::FScope& Fused = FusedScopes[Iteration];
+
+			const PCGMetadataEntryKey Key = MutablePoints[Iteration].MetadataEntry;
+			MutablePoints[Iteration] = InPoints[FusedIndices[Fused.Start]]; // Copy first point properties, in case there's only one
+
+			FPCGPoint& Point = MutablePoints[Iteration];
+			Point.MetadataEntry = Key; // Restore key
+
+			FVector Center = FVector::ZeroVector;
+			for (int32 i = Fused.Start; i < Fused.End; i++) { Center += InPoints[FusedIndices[i]].Transform.GetLocation(); }
+			Point.Transform.SetLocation(Center / Fused.Count);
+
+			UnionBlender->MergeSingle(Iteration, Context->Distances);
+			return;
+		}
+
 		const TSharedPtr<PCGExGraph::FUnionNode> UnionNode = UnionGraph->Nodes[Iteration];
 		const PCGMetadataEntryKey Key = MutablePoints[Iteration].MetadataEntry;
 		MutablePoints[Iteration] = UnionNode->Point; // Copy "original" point properties, in case there's only one
@@ -100,16 +134,71 @@ namespace PCGExFusePoints
 
 	void FProcessor::CompleteWork()
 	{
-		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
+		if (bFuseByVoxel) { BuildVoxelUnion(); }
+
+		const int32 NumUnionNodes = bFuseByVoxel ? FusedScopes.Num() : UnionGraph->Nodes.Num();
 		PointDataFacade->Source->GetOut()->GetMutablePoints().SetNum(NumUnionNodes);
 
 		UnionBlender = MakeShared<PCGExDataBlending::FUnionBlender>(const_cast<FPCGExBlendingDetails*>(&Settings->BlendingDetails), &Context->CarryOverDetails);
 		UnionBlender->AddSource(PointDataFacade, &PCGExGraph::ProtectedClusterAttributes);
-		UnionBlender->PrepareMerge(Context, PointDataFacade, UnionGraph->NodesUnion);
+		UnionBlender->PrepareMerge(Context, PointDataFacade, bFuseByVoxel ? PointsUnion : UnionGraph->NodesUnion);
 
 		StartParallelLoopForRange(NumUnionNodes);
 	}
 
+	void FProcessor::BuildVoxelUnion()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExFusePoints::BuildVoxelUnion);
+
+		const int32 NumPoints = GridKeys.Num();
+
+		// Sort point indices by grid key ; the sort is stable so members of a voxel stay in ascending index order
+		TArray<uint64> SortKeys;
+		SortKeys.SetNumUninitialized(NumPoints);
+		PCGExMT::ParallelForBlocking(NumPoints, [&](const int32 i) { SortKeys[i] = GridKeys[i]; });
+
+		PCGEx::ArrayOfIndices(FusedIndices, NumPoints);
+		PCGExMT::RadixSort(SortKeys, FusedIndices);
+
+		TArray<int32> VoxelStarts;
+		const int32 NumVoxels = PCGExMT::GetCompactionIndices(VoxelStarts, NumPoints, [&](const int32 i) { return i == 0 || SortKeys[i] != SortKeys[i - 1]; });
+
+		// Output fused points in the order of their first member, same as a sequential insertion would
+		TArray<uint64> FirstIndices;
+		FirstIndices.SetNumUninitialized(NumVoxels);
+		PCGExMT::ParallelForBlocking(NumVoxels, [&](const int32 i) { FirstIndices[i] = FusedIndices[VoxelStarts[i]]; });
+
+		TArray<int32> VoxelOrder;
+		PCGEx::ArrayOfIndices(VoxelOrder, NumVoxels);
+		PCGExMT::RadixSort(FirstIndices, VoxelOrder);
+
+		const int32 IOIndex = PointDataFacade->Source->IOIndex;
+
+		PointsUnion = MakeShared<PCGExData::FUnionMetadata>();
+		PointsUnion->Entries.SetNum(NumVoxels);
+		FusedScopes.SetNumUninitialized(NumVoxels);
+
+		PCGExMT::ParallelForBlocking(
+			NumVoxels, [&](const int32 i)
+			{
+				const int32 VoxelIndex = VoxelOrder[i];
+				const int32 Start = VoxelStarts[VoxelIndex];
+				const int32 End = VoxelIndex == NumVoxels - 1 ? NumPoints : VoxelStarts[VoxelIndex + 1];
+
+				const PCGExMT::FScope& Fused = FusedScopes[i] = PCGExMT::FScope(Start, End - Start);
+
+				// Each entry is only touched by this iteration, fill it directly instead of going through the locked Add
+				const TSharedPtr<PCGExData::FUnionData> Union = MakeShared<PCGExData::FUnionData>();
+				Union->IOIndices.Add(IOIndex);
+				Union->ItemHashSet.Reserve(Fused.Count);
+				for (int32 j = Fused.Start; j < Fused.End; j++) { Union->ItemHashSet.Add(PCGEx::H64(IOIndex, FusedIndices[j])); }
+
+				PointsUnion->Entries[i] = Union;
+			});
+
+		GridKeys.Empty();
+	}
+
 	void FProcessor::Write()
 	{
 		PointDataFacade->Write(AsyncManager);
@@ -16,87 +16,6 @@ namespace PCGExPartitionByValues
 	const FName SourceLabel = TEXT("Source");
 }
 
-namespace PCGExPartition
-{
-	FKPartition::FKPartition(const TWeakPtr<FKPartition>& InParent, const int64 InKey, FRule* InRule, const int32 InPartitionIndex)
-		: Parent(InParent), PartitionIndex(InPartitionIndex), PartitionKey(InKey), Rule(InRule)
-	{
-	}
-
-	FKPartition::~FKPartition()
-	{
-	}
-
-	int32 FKPartition::GetSubPartitionsNum()
-	{
-		if (SubLayers.IsEmpty()) { return 1; }
-
-		int32 Num = 0;
-		for (const TPair<int64, TSharedPtr<FKPartition>>& Pair : SubLayers) { Num += Pair.Value->GetSubPartitionsNum(); }
-		return Num;
-	}
-
-	TSharedPtr<FKPartition> FKPartition::GetPartition(const int64 Key, FRule* InRule)
-	{
-		TSharedPtr<FKPartition>* LayerPtr;
-
-		{
-			FReadScopeLock ReadLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
-			if (LayerPtr) { return *LayerPtr; }
-		}
-
-		{
-			FWriteScopeLock WriteLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
-
-			if (LayerPtr) { return *LayerPtr; }
-
-			PCGEX_SHARED_THIS_DECL
-			TSharedPtr<FKPartition> Partition = MakeShared<FKPartition>(ThisPtr, Key, InRule, SubLayers.Num());
-
-			UniquePartitionKeys.Add(Key);
-			SubLayers.Add(Key, Partition);
-			return Partition;
-		}
-	}
-
-	void FKPartition::Register(TArray<TSharedPtr<FKPartition>>& Partitions)
-	{
-		if (!SubLayers.IsEmpty())
-		{
-			for (const TPair<int64, TSharedPtr<FKPartition>>& Pair : SubLayers) { Pair.Value->Register(Partitions); }
-		}
-		else
-		{
-			PCGEX_SHARED_THIS_DECL
-			Partitions.Add(ThisPtr);
-		}
-	}
-
-	void FKPartition::SortPartitions()
-	{
-		TMap<int64, int64> ValuesIndices;
-		TArray<int64> UValues = UniquePartitionKeys.Array();
-		UValues.Sort();
-
-		int64 PIndex = 0;
-		for (int64 UniquePartitionKey : UValues) { ValuesIndices.Add(UniquePartitionKey, PIndex++); }
-		UValues.Empty();
-
-		for (const TPair<int64, TSharedPtr<FKPartition>>& Pair : SubLayers)
-		{
-			Pair.Value->SortPartitions();
-			Pair.Value->PartitionIndex = *ValuesIndices.Find(Pair.Value->PartitionKey); //Ordered index
-		}
-
-		Points.Sort([](const int32& A, const int32& B) { return A < B; });
-
-		ValuesIndices.Empty();
-		UniquePartitionKeys.Empty();
-	}
-}
-
 #if WITH_EDITOR
 void UPCGExPartitionByValuesSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -199,8 +118,6 @@ namespace PCGExPartitionByValues
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
 
-		RootPartition = MakeShared<PCGExPartition::FKPartition>(nullptr, 0, nullptr, -1);
-
 		Rules.Empty();
 		const int32 NumPoints = PointDataFacade->GetNum();
 
@@ -234,58 +151,48 @@ namespace PCGExPartitionByValues
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		TSharedPtr<PCGExPartition::FKPartition> Partition = RootPartition;
-		for (PCGExPartition::FRule& Rule : Rules)
-		{
-			const int64 KeyValue = Rule.Filter(Index);
-			Partition = Partition->GetPartition(KeyValue, &Rule);
-			Rule.FilteredValues[Index] = KeyValue;
-		}
-
-		Partition->Add(Index);
+		for (PCGExPartition::FRule& Rule : Rules) { Rule.FilteredValues[Index] = Rule.Filter(Index); }
 	}
 
 	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope)
 	{
-		TSharedPtr<PCGExPartition::FKPartition> Partition = Partitions[Iteration];
+		const PCGExPartition::FKPartition& Partition = Partitions[Iteration];
 
 		//Manually create & insert partition at the sorted IO Index
-		const TSharedRef<PCGExData::FPointIO> PartitionIO = Context->MainPoints->Pairs[Partition->IOIndex].ToSharedRef();
-
-		UPCGMetadata* Metadata = PartitionIO->GetOut()->Metadata;
+		const TSharedRef<PCGExData::FPointIO> PartitionIO = Context->MainPoints->Pairs[Partition.IOIndex].ToSharedRef();
 
 		const TArray<FPCGPoint>& InPoints = PartitionIO->GetIn()->GetPoints();
 		TArray<FPCGPoint>& OutPoints = PartitionIO->GetOut()->GetMutablePoints();
-		PCGEx::InitArray(OutPoints, Partition->Points.Num());
+		PCGEx::InitArray(OutPoints, Partition.Count);
 
-		for (int i = 0; i < OutPoints.Num(); i++)
-		{
-			OutPoints[i] = InPoints[Partition->Points[i]];
-			Metadata->InitializeOnSet(OutPoints[i].MetadataEntry);
-		}
+		for (int i = 0; i < OutPoints.Num(); i++) { OutPoints[i] = InPoints[SortedIndices[Partition.Start + i]]; }
+		PartitionIO->InitPoints();
+
+		const int32 FirstIndex = SortedIndices[Partition.Start];
+		const int32 NumRules = Rules.Num();
 
 		int64 Sum = 0;
-		while (Partition->Parent.Pin())
+		for (int r = NumRules - 1; r >= 0; r--)
 		{
-			const PCGExPartition::FRule* Rule = Partition->Rule;
-			Sum += Partition->PartitionKey;
+			const PCGExPartition::FRule& Rule = Rules[r];
+			const int64 PartitionKey = Rule.FilteredValues[FirstIndex];
+			const int64 PartitionIndex = PartitionIndices[Partition.Order * NumRules + r];
+			Sum += PartitionKey;
 
-			if (Rule->RuleConfig->bWriteKey)
+			if (Rule.RuleConfig->bWriteKey)
 			{
 				PCGExData::WriteMark<int64>(
 					PartitionIO,
-					Rule->RuleConfig->KeyAttributeName,
-					Rule->RuleConfig->bUsePartitionIndexAsKey ? Partition->PartitionIndex : Partition->PartitionKey);
+					Rule.RuleConfig->KeyAttributeName,
+					Rule.RuleConfig->bUsePartitionIndexAsKey ? PartitionIndex : PartitionKey);
 			}
 
-			if (Rule->RuleConfig->bWriteTag)
+			if (Rule.RuleConfig->bWriteTag)
 			{
 				PartitionIO->Tags->Set<int64>(
-					Rule->RuleConfig->TagPrefixName.ToString(),
-					Rule->RuleConfig->bTagUsePartitionIndexAsKey ? Partition->PartitionIndex : Partition->PartitionKey);
+					Rule.RuleConfig->TagPrefixName.ToString(),
+					Rule.RuleConfig->bTagUsePartitionIndexAsKey ? PartitionIndex : PartitionKey);
 			}
-
-			Partition = Partition->Parent.Pin();
 		}
 
 		if (Settings->bWriteKeySum) { PCGExData::WriteMark<int64>(PartitionIO, Settings->KeySumAttributeName, Sum); }
@@ -294,25 +201,82 @@ namespace PCGExPartitionByValues
 	void FProcessor::CompleteWork()
 	{
 		FPointsProcessor::CompleteWork();
-		RootPartition->SortPartitions();
 
 		if (Settings->bSplitOutput)
 		{
-			NumPartitions = RootPartition->GetSubPartitionsNum();
-			Partitions.Reserve(NumPartitions);
-			RootPartition->Register(Partitions);
+			const int32 NumPoints = PointDataFacade->GetNum();
+			const int32 NumRules = Rules.Num();
+
+			// Stable radix sort the point indices one rule at a time, starting from the last one.
+			// This leaves them in the lexicographic order of their rule keys, ascending within each partition,
+			// so every partition ends up as a contiguous range.
+			PCGEx::ArrayOfIndices(SortedIndices, NumPoints);
+
+			TArray<uint64> SortKeys;
+			SortKeys.SetNumUninitialized(NumPoints);
+
+			for (int r = NumRules - 1; r >= 0; r--)
+			{
+				const TArray<int64>& Values = Rules[r].FilteredValues;
+
+				// Flip the sign bit so signed keys sort in the right order as unsigned
+				PCGExMT::ParallelForBlocking(NumPoints, [&](const int32 i) { SortKeys[i] = static_cast<uint64>(Values[SortedIndices[i]]) ^ (1ULL << 63); });
+				PCGExMT::RadixSort(SortKeys, SortedIndices);
+			}
+
+			auto IsSameKey = [&](const int32 A, const int32 B)
+			{
+				for (const PCGExPartition::FRule& Rule : Rules) { if (Rule.FilteredValues[A] != Rule.FilteredValues[B]) { return false; } }
+				return true;
+			};
+
+			TArray<int32> PartitionStarts;
+			NumPartitions = PCGExMT::GetCompactionIndices(
+				PartitionStarts, NumPoints,
+				[&](const int32 i) { return i == 0 || !IsSameKey(SortedIndices[i], SortedIndices[i - 1]); });
+
+			Partitions.SetNum(NumPartitions);
+			PartitionIndices.SetNumUninitialized(NumPartitions * NumRules);
+
+			// Partition index of a key is its rank among the keys sharing the same parent keys,
+			// which in lexicographic order means counting up until a parent key changes.
+			for (int p = 0; p < NumPartitions; p++)
+			{
+				PCGExPartition::FKPartition& Partition = Partitions[p];
+				Partition.Order = p;
+				Partition.Start = PartitionStarts[p];
+				Partition.Count = (p == NumPartitions - 1 ? NumPoints : PartitionStarts[p + 1]) - Partition.Start;
+
+				int32 FirstDiff = 0;
+				if (p > 0)
+				{
+					const int32 A = SortedIndices[Partition.Start];
+					const int32 B = SortedIndices[PartitionStarts[p - 1]];
+					while (FirstDiff < NumRules && Rules[FirstDiff].FilteredValues[A] == Rules[FirstDiff].FilteredValues[B]) { FirstDiff++; }
+				}
+
+				for (int r = 0; r < NumRules; r++)
+				{
+					int64& PartitionIndex = PartitionIndices[p * NumRules + r];
+					if (p == 0 || r > FirstDiff) { PartitionIndex = 0; }
+					else if (r == FirstDiff) { PartitionIndex = PartitionIndices[(p - 1) * NumRules + r] + 1; }
+					else { PartitionIndex = PartitionIndices[(p - 1) * NumRules + r]; }
+				}
+			}
 
 			// Sort by point index & ensure consistent output partition order
+			Partitions.Sort(
+				[&](const PCGExPartition::FKPartition& A, const PCGExPartition::FKPartition& B)
+				{
+					return SortedIndices[A.Start] < SortedIndices[B.Start];
+				});
 
-			Partitions.Sort([](const TSharedPtr<PCGExPartition::FKPartition>& A, const TSharedPtr<PCGExPartition::FKPartition>& B) { return A->Points[0] < B->Points[0]; });
 			const int32 InsertOffset = Context->MainPoints->Pairs.Num();
 
-			int32 SumPts = 0;
 			for (int i = 0; i < Partitions.Num(); i++)
 			{
-				Partitions[i]->IOIndex = InsertOffset + i;
+				Partitions[i].IOIndex = InsertOffset + i;
 				Context->MainPoints->Emplace_GetRef(PointDataFacade->Source, PCGExData::EIOInit::New);
-				SumPts += Partitions[i]->Points.Num();
 			}
 
 			StartParallelLoopForRange(NumPartitions, 64); // Too low maybe?
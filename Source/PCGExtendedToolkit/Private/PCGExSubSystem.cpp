@@ -27,6 +27,8 @@ void UPCGExSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UPCGExSubSystem::Deinitialize()
 {
+	// Releases shared data and cleans up any spilled disk cache
+	if (SharedDataManager) { SharedDataManager->Flush(); }
 	Super::Deinitialize();
 }
 
@@ -384,20 +384,15 @@ namespace PCGExBevelPath
 		const FPCGPoint& OriginalPoint = PointIO->GetInPoint(Iteration);
 
 		TArray<FPCGPoint>& MutablePoints = PointIO->GetOut()->GetMutablePoints();
-		UPCGMetadata* Metadata = PointIO->GetOut()->Metadata;
 
+		// Metadata entries are initialized in bulk once all ranges are processed
 		if (!Bevel)
 		{
 			MutablePoints[StartIndex] = OriginalPoint;
-			Metadata->InitializeOnSet(MutablePoints[StartIndex].MetadataEntry);
 			return;
 		}
 
-		for (int i = Bevel->StartOutputIndex; i <= Bevel->EndOutputIndex; i++)
-		{
-			MutablePoints[i] = OriginalPoint;
-			Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry);
-		}
+		for (int i = Bevel->StartOutputIndex; i <= Bevel->EndOutputIndex; i++) { MutablePoints[i] = OriginalPoint; }
 
 		FPCGPoint& StartPoint = PointIO->GetMutablePoint(Bevel->StartOutputIndex);
 		FPCGPoint& EndPoint = PointIO->GetMutablePoint(Bevel->EndOutputIndex);
@@ -418,6 +413,11 @@ namespace PCGExBevelPath
 		}
 	}
 
+	void FProcessor::OnRangeProcessingComplete()
+	{
+		PointDataFacade->Source->InitPoints();
+	}
+
 	void FProcessor::WriteFlags(const int32 Index)
 	{
 		const TSharedPtr<FBevel>& Bevel = Bevels[Index];
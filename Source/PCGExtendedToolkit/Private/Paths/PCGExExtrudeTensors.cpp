@@ -326,13 +326,7 @@ namespace PCGExExtrudeTensors
 	{
 		if (RemainingIterations <= 0) { return true; }
 
-		int32 WriteIndex = 0;
-		for (int i = 0; i < ExtrusionQueue.Num(); i++)
-		{
-			if (ExtrusionQueue[i]) { ExtrusionQueue[WriteIndex++] = ExtrusionQueue[i]; }
-		}
-
-		ExtrusionQueue.SetNum(WriteIndex);
+		PCGExMT::Compact(ExtrusionQueue, [&](const int32 Index) { return ExtrusionQueue[Index].IsValid(); });
 
 		if (!NewExtrusions.IsEmpty())
 		{
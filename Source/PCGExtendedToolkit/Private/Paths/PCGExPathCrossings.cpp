@@ -66,7 +66,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 
 		const bool bIsCanBeCutTagValid = PCGEx::IsValidStringTag(Context->CanBeCutTag);
 
-		if (!Context->StartBatchProcessingPoints<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>(
+		if (!Context->StartBatchProcessingPoints<PCGExPathCrossings::FBatch>(
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry)
 			{
 				if (Entry->GetNum() < 2)
@@ -81,7 +81,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 				}
 				return true;
 			},
-			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>& NewBatch)
+			[&](const TSharedPtr<PCGExPathCrossings::FBatch>& NewBatch)
 			{
 				NewBatch->PrimaryOperation = Context->Blending;
 				//NewBatch->SetPointsFilterData(&Context->FilterFactories);
@@ -151,8 +151,13 @@ namespace PCGExPathCrossings
 
 				This->CanCutFilterManager.Reset();
 				This->CanBeCutFilterManager.Reset();
-				This->Path->BuildPartialEdgeOctree(This->CanCut);
-				This->CanCut.Empty();
+
+				// Otherwise cutting edges are gathered into the batch-wide BVH on completion
+				if (This->bSelfIntersectionOnly)
+				{
+					This->Path->BuildPartialEdgeOctree(This->CanCut);
+					This->CanCut.Empty();
+				}
 			};
 
 		Preparation->OnSubLoopStartCallback =
@@ -262,23 +267,15 @@ namespace PCGExPathCrossings
 		}
 		else
 		{
-			for (const TSharedPtr<PCGExPointsMT::FPointsProcessorBatchBase> Parent = ParentBatch.Pin();
-			     const TSharedRef<PCGExData::FFacade>& Facade : Parent->ProcessorFacades)
-			{
-				const TSharedRef<FPointsProcessor>* OtherProcessorPtr = Parent->SubProcessorMap->Find(&Facade->Source.Get());
-				if (!OtherProcessorPtr) { continue; }
-
-				TSharedRef<FPointsProcessor> OtherProcessor = *OtherProcessorPtr;
-				if (!Details.bEnableSelfIntersection && &OtherProcessor.Get() == this) { continue; }
-
-				const TSharedRef<FProcessor> TypedProcessor = StaticCastSharedRef<FProcessor>(OtherProcessor);
-				if (!TypedProcessor->bCanCut) { return; }
-
-				CurrentIOIndex = TypedProcessor->PointDataFacade->Source->IOIndex;
+			Context->EdgeBVH->FindSegmentCandidates(
+				Path->GetPos(Edge.Start), Path->GetPos(Edge.End), 0, [&](const PCGExPaths::FPath* InPath, const PCGExPaths::FPathEdge& OtherEdge)
+				{
+					if (!Details.bEnableSelfIntersection && InPath == Path.Get()) { return; }
 
-				OtherPath = TypedProcessor->Path.Get();
-				TypedProcessor->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge) { FindSplit(*OtherEdge); });
-			}
+					OtherPath = InPath;
+					CurrentIOIndex = InPath->IOIndex;
+					FindSplit(OtherEdge);
+				});
 		}
 
 		if (!NewCrossing->Crossings.IsEmpty()) { Crossings[Iteration] = NewCrossing; }
@@ -306,7 +303,6 @@ namespace PCGExPathCrossings
 
 		const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
 		TArray<FPCGPoint>& OutPoints = PointIO->GetOut()->GetMutablePoints();
-		UPCGMetadata* Metadata = PointIO->GetOut()->Metadata;
 
 		PCGEx::InitArray(OutPoints, NumPointsFinal);
 
@@ -316,8 +312,7 @@ namespace PCGExPathCrossings
 			Path->Edges[i].AltStart = Index;
 
 			const FPCGPoint& OriginalPoint = InPoints[i];
-			OutPoints[Index] = OriginalPoint;
-			Metadata->InitializeOnSet(OutPoints[Index++].MetadataEntry);
+			OutPoints[Index++] = OriginalPoint;
 
 			const FCrossing* Crossing = Crossings[i].Get();
 			if (!Crossing) { continue; }
@@ -325,8 +320,7 @@ namespace PCGExPathCrossings
 			for (const uint64 Hash : Crossing->Crossings)
 			{
 				CrossIOIndices.Add(PCGEx::H64B(Hash));
-				OutPoints[Index] = OriginalPoint;
-				Metadata->InitializeOnSet(OutPoints[Index++].MetadataEntry);
+				OutPoints[Index++] = OriginalPoint;
 			}
 		}
 
@@ -334,9 +328,10 @@ namespace PCGExPathCrossings
 		{
 			const FPCGPoint& OriginalPoint = InPoints[Path->LastIndex];
 			OutPoints[Index] = OriginalPoint;
-			Metadata->InitializeOnSet(OutPoints[Index].MetadataEntry);
 		}
 
+		PointIO->InitPoints();
+
 		// Flag last so it doesn't get captured by blenders
 		if (Settings->IntersectionDetails.bWriteCrossing)
 		{
@@ -458,8 +453,16 @@ namespace PCGExPathCrossings
 		}
 	}
 
+	void FProcessor::RegisterCuttingEdges(PCGExPaths::FPathEdgeBVH& InEdgeBVH) const
+	{
+		if (!bCanCut) { return; }
+		InEdgeBVH.AddPath(Path, &CanCut);
+	}
+
 	void FProcessor::CompleteWork()
 	{
+		CanCut.Empty();
+
 		if (!bCanBeCut) { return; }
 		StartParallelLoopForRange(Path->NumEdges);
 	}
@@ -494,6 +497,24 @@ namespace PCGExPathCrossings
 			};
 		CrossBlendTask->StartSubLoops(Path->NumEdges, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 	}
+
+	void FBatch::CompleteWork()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		if (!Settings->bSelfIntersectionOnly)
+		{
+			Context->EdgeBVH = MakeShared<PCGExPaths::FPathEdgeBVH>();
+			for (const TSharedRef<FProcessor>& Processor : Processors)
+			{
+				if (!Processor->bIsProcessorValid) { continue; }
+				Processor->RegisterCuttingEdges(*Context->EdgeBVH);
+			}
+			Context->EdgeBVH->Build();
+		}
+
+		TBatch<FProcessor>::CompleteWork();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -228,6 +228,87 @@ namespace PCGExPaths
 		GetMutable(Edge.Start) = PI;
 	}
 
+#pragma endregion
+
+#pragma region FPathEdgeBVH
+
+	int32 FPathEdgeBVH::AddPath(const TSharedPtr<FPath>& InPath, const TArray<int8>* InFilter)
+	{
+		check(Nodes.IsEmpty()) // Can't add paths once built
+		Filters.Add(InFilter);
+		return Paths.Add(InPath);
+	}
+
+	void FPathEdgeBVH::Build()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPathEdgeBVH::Build);
+
+		Items.Reset();
+		ItemBounds.Reset();
+		Nodes.Reset();
+
+		const int32 NumPaths = Paths.Num();
+		if (!NumPaths) { return; }
+
+		// Lay out eligible edges path after path
+
+		TArray<int32> Offsets;
+		Offsets.SetNumZeroed(NumPaths + 1);
+
+		PCGExMT::ParallelForBlocking(
+			NumPaths, [&](const int32 PathIndex)
+			{
+				const FPath* P = Paths[PathIndex].Get();
+				const TArray<int8>* Filter = Filters[PathIndex];
+				int32 Count = 0;
+				for (int i = 0; i < P->NumEdges; i++) { if ((!Filter || (*Filter)[i]) && P->IsEdgeValid(i)) { Count++; } }
+				Offsets[PathIndex + 1] = Count;
+			}, NumPaths <= 1);
+
+		for (int i = 0; i < NumPaths; i++) { Offsets[i + 1] += Offsets[i]; }
+
+		const int32 NumItems = Offsets[NumPaths];
+		if (!NumItems) { return; }
+
+		TArray<FItem> UnorderedItems;
+		UnorderedItems.SetNumUninitialized(NumItems);
+		ItemBounds.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelForBlocking(
+			NumPaths, [&](const int32 PathIndex)
+			{
+				const FPath* P = Paths[PathIndex].Get();
+				const TArray<int8>* Filter = Filters[PathIndex];
+				int32 WriteIndex = Offsets[PathIndex];
+				for (int i = 0; i < P->NumEdges; i++)
+				{
+					if ((Filter && !(*Filter)[i]) || !P->IsEdgeValid(i)) { continue; }
+					UnorderedItems[WriteIndex] = FItem{PathIndex, i};
+					ItemBounds[WriteIndex] = P->Edges[i].Bounds.GetBox();
+					WriteIndex++;
+				}
+			}, NumPaths <= 1);
+
+		TArray<int32> Order;
+		PCGExGeo::BuildBVH(ItemBounds, Nodes, Order);
+
+		// Store items in leaf order so leaves reference contiguous ranges
+
+		TArray<FBox> OrderedBounds;
+		Items.SetNumUninitialized(NumItems);
+		OrderedBounds.SetNumUninitialized(NumItems);
+
+		PCGExMT::ParallelForBlocking(
+			NumItems, [&](const int32 i)
+			{
+				Items[i] = UnorderedItems[Order[i]];
+				OrderedBounds[i] = ItemBounds[Order[i]];
+			}, NumItems <= PCGExMT::CompactionScopeSize);
+
+		ItemBounds = MoveTemp(OrderedBounds);
+		Filters.Empty();
+	}
+
 #pragma endregion
 }
 #undef LOCTEXT_NAMESPACE
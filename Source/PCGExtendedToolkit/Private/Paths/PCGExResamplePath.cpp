@@ -4,6 +4,7 @@
 #include "Paths/PCGExResamplePath.h"
 
 #include "PCGExDataMath.h"
+#include "Algo/BinarySearch.h"
 
 #define LOCTEXT_NAMESPACE "PCGExResamplePathElement"
 #define PCGEX_NAMESPACE ResamplePath
@@ -62,7 +63,8 @@ namespace PCGExResamplePath
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExResamplePath::Process);
 
 		// Must be set before process for filters
-		PointDataFacade->bSupportsScopedGet = false; //Context->bScopedAttributeGet;
+		// Samples blend from arbitrary input points, so attributes can't be fetched per-scope
+		PointDataFacade->bSupportsScopedGet = false;
 
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
@@ -102,87 +104,50 @@ namespace PCGExResamplePath
 		SampleLength = PathLength->TotalLength / static_cast<double>(NumSamples - 1);
 
 		Samples.SetNumUninitialized(NumSamples);
-		bInlineProcessPoints = true;
 
-		int32 StartIndex = 0;
-		int32 EndIndex = 1;
-		FVector PrevPosition = InPoints[0].Transform.GetLocation();
-		double TraversedDistance = 0;
-
-		FPointSample& FirstSample = Samples[0];
-		FirstSample.Start = StartIndex;
-		FirstSample.End = EndIndex;
-		FirstSample.Location = PrevPosition;
-		FirstSample.Distance = TraversedDistance;
-
-		for (int i = 1; i < NumSamples; i++)
-		{
-			FPointSample& Sample = Samples[i];
-			Sample.Start = StartIndex;
+		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
+		MetadataBlender->PrepareForData(PointDataFacade);
 
-			FVector NextPosition = InPoints[EndIndex].Transform.GetLocation();
-			double DistToNext = FVector::Dist(PrevPosition, NextPosition);
-			double Remainder = SampleLength - DistToNext;
+		StartParallelLoopForPoints();
 
-			if (Remainder <= 0)
-			{
-				// Overshooting
-				PrevPosition = PrevPosition + (Path->DirToNextPoint(StartIndex) * SampleLength);
-				TraversedDistance += SampleLength;
-			}
-			else
-			{
-				PrevPosition = NextPosition;
+		return true;
+	}
 
-				while (Remainder > 0)
-				{
-					StartIndex = EndIndex++;
+	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
+	{
+		PointDataFacade->Fetch(Scope);
 
-					if (EndIndex >= InPoints.Num())
-					{
-						if (!Path->IsClosedLoop())
-						{
-							EndIndex = InPoints.Num() - 1;
-							break;
-						}
+		// Samples are evenly spaced along the cumulative length; locate the first edge of the scope
+		// with a binary search, then walk forward since sample distances are monotonic.
+		const TArray<double>& CumulativeLength = PathLength->CumulativeLength;
+		const int32 LastEdge = Path->NumEdges - 1;
 
-						EndIndex = 0;
-					}
+		int32 EdgeIndex = FMath::Min(LastEdge, Algo::UpperBound(CumulativeLength, Scope.Start * SampleLength));
 
-					NextPosition = InPoints[EndIndex].Transform.GetLocation();					
-					DistToNext = FVector::Dist(PrevPosition, NextPosition);
+		for (int i = Scope.Start; i < Scope.End; i++)
+		{
+			const double Distance = FMath::Min(i * SampleLength, PathLength->TotalLength);
+			while (EdgeIndex < LastEdge && CumulativeLength[EdgeIndex] <= Distance) { EdgeIndex++; }
 
-					if (Remainder <= DistToNext) { PrevPosition = PrevPosition + (Path->DirToPrevPoint(EndIndex) * -Remainder); }
-					else { PrevPosition = NextPosition; }
-					Remainder -= DistToNext;
-				}
-			}
+			const PCGExPaths::FPathEdge& Edge = Path->Edges[EdgeIndex];
+			const double EdgeLength = PathLength->Get(EdgeIndex);
+			const double Offset = FMath::Clamp(Distance - (CumulativeLength[EdgeIndex] - EdgeLength), 0, EdgeLength);
 
-			Sample.End = EndIndex;
-			Sample.Location = PrevPosition;
-			Sample.Distance = TraversedDistance;
+			FPointSample& Sample = Samples[i];
+			Sample.Start = Edge.Start;
+			Sample.End = Edge.End;
+			Sample.Location = Path->GetPos_Unsafe(Edge.Start) + Path->DirToNextPoint(Edge.Start) * Offset;
+			Sample.Distance = Distance;
 		}
 
-		if (Settings->bPreserveLastPoint && !Path->IsClosedLoop())
+		if (Settings->bPreserveLastPoint && !Path->IsClosedLoop() && Scope.End == NumSamples)
 		{
+			const TArray<FPCGPoint>& InPoints = PointDataFacade->GetIn()->GetPoints();
 			FPointSample& LastSample = Samples.Last();
 			LastSample.Start = InPoints.Num() - 2;
 			LastSample.End = InPoints.Num() - 1;
 			LastSample.Location = InPoints.Last().Transform.GetLocation();
-			LastSample.Distance = TraversedDistance;
 		}
-
-		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
-		MetadataBlender->PrepareForData(PointDataFacade);
-
-		StartParallelLoopForPoints();
-
-		return true;
-	}
-
-	void FProcessor::PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope)
-	{
-		PointDataFacade->Fetch(Scope);
 	}
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
@@ -86,9 +86,23 @@ namespace PCGExSmooth
 		bClosedLoop = Context->ClosedLoop.IsClosedLoop(PointDataFacade->Source);
 		NumPoints = PointDataFacade->GetNum();
 
+		TypedOperation = Cast<UPCGExSmoothingOperation>(PrimaryOperation);
+
+		// When the method supports it, point properties are smoothed for the whole path at once
+		// and the per-point blender only deals with attributes, if any.
+		PropertiesBlending = Settings->BlendingSettings.GetPropertiesBlendingDetails();
+		bSmoothPropertiesAtOnce = TypedOperation->CanSmoothProperties(PropertiesBlending);
+
 		MetadataBlender = MakeShared<PCGExDataBlending::FMetadataBlender>(&Settings->BlendingSettings);
+		MetadataBlender->bBlendProperties = !bSmoothPropertiesAtOnce;
 		MetadataBlender->PrepareForData(PointDataFacade);
 
+		if (bSmoothPropertiesAtOnce)
+		{
+			SmoothingAmounts.Init(0, NumPoints);
+			bBlendAttributes = !MetadataBlender->OperationIdMap.IsEmpty();
+		}
+
 		if (Settings->InfluenceInput == EPCGExInputValueType::Attribute)
 		{
 			Influence = PointDataFacade->GetScopedBroadcaster<double>(Settings->InfluenceAttribute);
@@ -109,8 +123,6 @@ namespace PCGExSmooth
 			}
 		}
 
-		TypedOperation = Cast<UPCGExSmoothingOperation>(PrimaryOperation);
-
 		StartParallelLoopForPoints();
 
 		return true;
@@ -131,17 +143,25 @@ namespace PCGExSmooth
 		PCGExData::FPointRef PtRef = PointIO->GetOutPointRef(Index);
 		const double LocalSmoothing = Smoothing ? FMath::Clamp(Smoothing->Read(Index), 0, MAX_dbl) * Settings->ScaleSmoothingAmountAttribute : Settings->SmoothingAmountConstant;
 
-		if ((Settings->bPreserveEnd && Index == NumPoints - 1) ||
-			(Settings->bPreserveStart && Index == 0))
+		const bool bPreserve = (Settings->bPreserveEnd && Index == NumPoints - 1) || (Settings->bPreserveStart && Index == 0);
+		const double LocalInfluence = bPreserve ? 0 : Influence ? Influence->Read(Index) : Settings->InfluenceConstant;
+
+		if (bSmoothPropertiesAtOnce)
 		{
-			TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, 0, MetadataBlender.Get(), bClosedLoop);
-			return;
+			// Influence scales every weight of the window alike, so it only matters when it nullifies smoothing
+			SmoothingAmounts[Index] = LocalInfluence == 0 ? 0 : LocalSmoothing;
+			if (!bBlendAttributes) { return; }
 		}
 
-		const double LocalInfluence = Influence ? Influence->Read(Index) : Settings->InfluenceConstant;
 		TypedOperation->SmoothSingle(PointIO, PtRef, LocalSmoothing, LocalInfluence, MetadataBlender.Get(), bClosedLoop);
 	}
 
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		if (!bSmoothPropertiesAtOnce) { return; }
+		TypedOperation->SmoothProperties(PointDataFacade->Source, PropertiesBlending, SmoothingAmounts, bClosedLoop);
+	}
+
 	void FProcessor::CompleteWork()
 	{
 		PointDataFacade->Write(AsyncManager);
@@ -182,9 +182,8 @@ namespace PCGExSubdivide
 
 			if (FlagWriter) { FlagWriter->GetMutable(Index) = true; }
 
-			const FVector Position = Sub.Start + Sub.Dir * (Sub.StartOffset + s * Sub.StepSize);
-			MutablePoints[Index].Transform.SetLocation(Position);
-			const double Alpha = Metrics.Add(Position) / Sub.Dist;
+			// Position was already set when the output was filled
+			const double Alpha = Metrics.Add(MutablePoints[Index].Transform.GetLocation()) / Sub.Dist;
 			if (AlphaWriter) { AlphaWriter->GetMutable(SubStart + s) = Alpha; }
 		}
 
@@ -200,20 +199,33 @@ namespace PCGExSubdivide
 	{
 		const TSharedRef<PCGExData::FPointIO>& PointIO = PointDataFacade->Source;
 
-		int32 NumPoints = 0;
+		const int32 NumSubdivisions = Subdivisions.Num();
+		if (!bClosedLoop) { Subdivisions[NumSubdivisions - 1].NumSubdivisions = 0; }
+
+		// Output layout as a parallel prefix sum : count per scope -> exclusive scan -> parallel write
+		TArray<PCGExMT::FScope> Scopes;
+		const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumSubdivisions, PCGExMT::CompactionScopeSize);
 
-		if (!bClosedLoop) { Subdivisions[Subdivisions.Num() - 1].NumSubdivisions = 0; }
+		TArray<int32> ScopeOffsets;
+		ScopeOffsets.SetNumUninitialized(NumScopes);
+
+		PCGExMT::ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				int32 Count = 0;
+				for (int i = Scope.Start; i < Scope.End; i++) { Count += 1 + Subdivisions[i].NumSubdivisions; }
+				ScopeOffsets[ScopeIndex] = Count;
+			});
 
-		for (FSubdivision& Sub : Subdivisions)
+		int32 NumPoints = 0;
+		for (int32& Offset : ScopeOffsets)
 		{
-			Sub.OutStart = NumPoints++;
-			NumPoints += Sub.NumSubdivisions;
-			Sub.OutEnd = NumPoints;
+			const int32 Count = Offset;
+			Offset = NumPoints;
+			NumPoints += Count;
 		}
 
-		if (bClosedLoop) { Subdivisions[Subdivisions.Num() - 1].OutEnd = 0; }
-		else { Subdivisions[Subdivisions.Num() - 1].NumSubdivisions = 0; }
-
 		if (NumPoints == PointIO->GetNum())
 		{
 			PCGEX_INIT_IO_VOID(PointIO, PCGExData::EIOInit::Duplicate)
@@ -227,27 +239,40 @@ namespace PCGExSubdivide
 
 		TArray<FPCGPoint>& MutablePoints = PointIO->GetOut()->GetMutablePoints();
 		const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
-		UPCGMetadata* Metadata = PointIO->GetOut()->Metadata;
 
-		PCGEx::InitArray(MutablePoints, NumPoints);
+		// Every output point is written below
+		MutablePoints.SetNumUninitialized(NumPoints);
 
-		for (int i = 0; i < Subdivisions.Num(); i++)
-		{
-			const FSubdivision& Sub = Subdivisions[i];
-			const FPCGPoint& OriginalPoint = InPoints[i];
-			MutablePoints[Sub.OutStart] = OriginalPoint;
-			Metadata->InitializeOnSet(MutablePoints[Sub.OutStart].MetadataEntry);
+		// Assign output ranges and fill the output in the same pass.
+		// Sub-points get their final position right away, the range loop only blends them.
+		PCGExMT::ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				int32 OutIndex = ScopeOffsets[ScopeIndex];
 
-			if (Sub.NumSubdivisions == 0) { continue; }
+				for (int i = Scope.Start; i < Scope.End; i++)
+				{
+					FSubdivision& Sub = Subdivisions[i];
+					const FPCGPoint& OriginalPoint = InPoints[i];
 
-			const int32 SubStart = Sub.OutStart + 1;
+					Sub.OutStart = OutIndex++;
+					MutablePoints[Sub.OutStart] = OriginalPoint;
 
-			for (int s = 0; s < Sub.NumSubdivisions; s++)
-			{
-				(MutablePoints[SubStart + s] = OriginalPoint).MetadataEntry = PCGInvalidEntryKey;
-				Metadata->InitializeOnSet(MutablePoints[SubStart + s].MetadataEntry);
-			}
-		}
+					for (int s = 0; s < Sub.NumSubdivisions; s++)
+					{
+						FPCGPoint& Pt = (MutablePoints[OutIndex++] = OriginalPoint);
+						Pt.MetadataEntry = PCGInvalidEntryKey;
+						Pt.Transform.SetLocation(Sub.Start + Sub.Dir * (Sub.StartOffset + s * Sub.StepSize));
+					}
+
+					Sub.OutEnd = OutIndex;
+				}
+			});
+
+		if (bClosedLoop) { Subdivisions[NumSubdivisions - 1].OutEnd = 0; }
+
+		PointIO->InitPoints();
 
 		if (Settings->bFlagSubPoints)
 		{
@@ -437,26 +437,20 @@ namespace PCGExPackActorDatas
 	void FProcessor::Write()
 	{
 		TArray<int32> ValidIndices;
-		PCGEx::ArrayOfIndices(ValidIndices, PointDataFacade->Source->GetNum());
 
 		if (Settings->bOmitUnresolvedEntries)
 		{
 			TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
-			const int32 NumPoints = MutablePoints.Num();
-			int32 WriteIndex = 0;
-			for (int32 i = 0; i < NumPoints; i++)
-			{
-				if (Packer->InputActors[i])
-				{
-					ValidIndices[WriteIndex] = i;
-					MutablePoints[WriteIndex++] = MutablePoints[i];
-				}
-			}
+			const TArray<TObjectPtr<AActor>>& InputActors = Packer->InputActors;
 
-			if (MutablePoints.IsEmpty() && Settings->bOmitEmptyOutputs) { return; }
+			PCGExMT::GetCompactionIndices(ValidIndices, MutablePoints.Num(), [&](const int32 Index) { return InputActors[Index] != nullptr; });
+			PCGExMT::Gather(MutablePoints, ValidIndices);
 
-			ValidIndices.SetNum(WriteIndex);
-			MutablePoints.SetNum(WriteIndex);
+			if (MutablePoints.IsEmpty() && Settings->bOmitEmptyOutputs) { return; }
+		}
+		else
+		{
+			PCGEx::ArrayOfIndices(ValidIndices, PointDataFacade->Source->GetNum());
 		}
 
 		/*
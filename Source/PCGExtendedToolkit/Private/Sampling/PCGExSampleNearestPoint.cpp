@@ -102,6 +102,9 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 	Context->TargetPoints = &Context->TargetsFacade->Source->GetIn()->GetPoints();
 	Context->NumTargets = Context->TargetPoints->Num();
 
+	Context->bCenterToCenterDistance = Settings->DistanceDetails.Source == EPCGExDistance::Center && Settings->DistanceDetails.Target == EPCGExDistance::Center;
+	if (Context->bCenterToCenterDistance) { Context->TargetPositions = Context->TargetsFacade->GetPositions(); }
+
 	Context->TargetOctree = &Context->TargetsFacade->Source->GetIn()->GetOctree();
 
 	if (Settings->WeightMode != EPCGExSampleWeightMode::Distance)
@@ -287,7 +290,12 @@ namespace PCGExSampleNearestPoints
 
 			double Dist = 0;
 
-			if (Settings->DistanceDetails.bOverlapIsZero)
+			if (Context->bCenterToCenterDistance)
+			{
+				// Center to center can't overlap
+				Dist = FVector::DistSquared(Origin, Context->TargetPositions[TargetPtIndex]);
+			}
+			else if (Settings->DistanceDetails.bOverlapIsZero)
 			{
 				bool bOverlap = false;
 				Dist = Context->DistanceDetails->GetDistSquared(Point, Target, bOverlap);
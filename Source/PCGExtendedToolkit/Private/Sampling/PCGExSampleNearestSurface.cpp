@@ -61,6 +61,22 @@ bool FPCGExSampleNearestSurfaceElement::Boot(FPCGExContext* InContext) const
 
 		Context->IncludedPrimitives.Reserve(IncludedPrimitiveSet.Num());
 		Context->IncludedPrimitives.Append(IncludedPrimitiveSet.Array());
+
+		if (Settings->bUseTriangleBVH)
+		{
+			Context->TriangleBVH = MakeShared<PCGExGeo::FTriangleBVH>();
+
+			// Primitives that can't be represented as triangles keep going through physics
+			Context->IncludedPrimitives.RemoveAll(
+				[&](UPrimitiveComponent* Primitive)
+				{
+					if (!IsValid(Primitive) || !Primitive->IsCollisionEnabled()) { return false; }
+					return Context->TriangleBVH->AddPrimitive(Primitive);
+				});
+
+			Context->TriangleBVH->Build();
+			if (Context->TriangleBVH->IsEmpty()) { Context->TriangleBVH.Reset(); }
+		}
 	}
 
 	Context->CollisionSettings = Settings->CollisionSettings;
@@ -181,11 +197,56 @@ namespace PCGExSampleNearestSurface
 		FVector HitLocation;
 		const int32* HitIndex = nullptr;
 		bool bSuccess = false;
+		float MinDist = MAX_FLT;
 		TArray<FOverlapResult> OutOverlaps;
 
+		auto OnSuccess = [&]()
+		{
+			PCGEX_OUTPUT_VALUE(Success, Index, true)
+			SampleState[Index] = true;
+
+			MaxDistanceValue->Set(Scope, FMath::Max(MaxDistanceValue->Get(Scope), MinDist));
+
+			FPlatformAtomics::InterlockedExchange(&bAnySuccess, 1);
+		};
+
+		auto ProcessTriangleHit = [&](const PCGExGeo::FTriangleHit& TriangleHit)
+		{
+			const FVector Direction = (TriangleHit.Location - Origin).GetSafeNormal();
+			const PCGExGeo::FTriangleSurface& Surface = Context->TriangleBVH->Surfaces[TriangleHit.Surface];
+
+			if (AActor* HitActor = Surface.Actor.Get())
+			{
+				HitIndex = Context->IncludedActors.Find(HitActor);
+				if (SurfacesForward && HitIndex) { SurfacesForward->Forward(*HitIndex, Index); }
+
+#if PCGEX_ENGINE_VERSION <= 503
+				PCGEX_OUTPUT_VALUE(ActorReference, Index, HitActor->GetPathName())
+#else
+				PCGEX_OUTPUT_VALUE(ActorReference, Index, FSoftObjectPath(HitActor->GetPathName()))
+#endif
+			}
+
+			if (const UPhysicalMaterial* PhysMat = Surface.PhysMat.Get())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				PCGEX_OUTPUT_VALUE(PhysMat, Index, PhysMat->GetPathName())
+#else
+				PCGEX_OUTPUT_VALUE(PhysMat, Index, FSoftObjectPath(PhysMat->GetPathName()))
+#endif
+			}
+
+			PCGEX_OUTPUT_VALUE(LookAt, Index, Direction)
+			PCGEX_OUTPUT_VALUE(Location, Index, TriangleHit.Location)
+			PCGEX_OUTPUT_VALUE(Normal, Index, TriangleHit.Normal)
+			PCGEX_OUTPUT_VALUE(IsInside, Index, FVector::DotProduct(Direction, TriangleHit.Normal) > 0)
+			PCGEX_OUTPUT_VALUE(Distance, Index, MinDist)
+
+			OnSuccess();
+		};
+
 		auto ProcessOverlapResults = [&]()
 		{
-			float MinDist = MAX_FLT;
 			UPrimitiveComponent* HitComp = nullptr;
 			for (const FOverlapResult& Overlap : OutOverlaps)
 			{
@@ -260,22 +321,20 @@ namespace PCGExSampleNearestSurface
 				PCGEX_OUTPUT_VALUE(Normal, Index, HitNormal)
 				PCGEX_OUTPUT_VALUE(IsInside, Index, bIsInside)
 				PCGEX_OUTPUT_VALUE(Distance, Index, MinDist)
-				PCGEX_OUTPUT_VALUE(Success, Index, true)
-				SampleState[Index] = true;
-
-				MaxDistanceValue->Set(Scope, FMath::Max(MaxDistanceValue->Get(Scope), MinDist));
 
-				FPlatformAtomics::InterlockedExchange(&bAnySuccess, 1);
-			}
-			else
-			{
-				SamplingFailed();
+				OnSuccess();
 			}
 		};
 
 
 		if (Settings->SurfaceSource == EPCGExSurfaceSource::ActorReferences)
 		{
+			PCGExGeo::FTriangleHit TriangleHit;
+			const bool bTriangleHit = Context->TriangleBVH && Context->TriangleBVH->FindClosest(Origin, MaxDistance, TriangleHit);
+
+			// Remaining physics primitives only need to beat the triangle hit
+			if (bTriangleHit) { MinDist = TriangleHit.Distance; }
+
 			for (const UPrimitiveComponent* Primitive : Context->IncludedPrimitives)
 			{
 				if (!IsValid(Primitive)) { continue; }
@@ -285,8 +344,14 @@ namespace PCGExSampleNearestSurface
 					OutOverlaps.Append(TempOverlaps);
 				}
 			}
-			if (OutOverlaps.IsEmpty()) { SamplingFailed(); }
-			else { ProcessOverlapResults(); }
+
+			if (!OutOverlaps.IsEmpty()) { ProcessOverlapResults(); }
+
+			if (!bSuccess)
+			{
+				if (bTriangleHit) { ProcessTriangleHit(TriangleHit); }
+				else { SamplingFailed(); }
+			}
 		}
 		else
 		{
@@ -299,26 +364,24 @@ namespace PCGExSampleNearestSurface
 				{
 					ProcessOverlapResults();
 				}
-				else { SamplingFailed(); }
 				break;
 			case EPCGExCollisionFilterType::ObjectType:
 				if (World->OverlapMultiByObjectType(OutOverlaps, Origin, FQuat::Identity, FCollisionObjectQueryParams(Context->CollisionSettings.CollisionObjectType), CollisionShape, CollisionParams))
 				{
 					ProcessOverlapResults();
 				}
-				else { SamplingFailed(); }
 				break;
 			case EPCGExCollisionFilterType::Profile:
 				if (World->OverlapMultiByProfile(OutOverlaps, Origin, FQuat::Identity, Context->CollisionSettings.CollisionProfileName, CollisionShape, CollisionParams))
 				{
 					ProcessOverlapResults();
 				}
-				else { SamplingFailed(); }
 				break;
 			default:
-				SamplingFailed();
 				break;
 			}
+
+			if (!bSuccess) { SamplingFailed(); }
 		}
 	}
 
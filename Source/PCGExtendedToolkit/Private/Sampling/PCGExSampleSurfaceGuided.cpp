@@ -7,6 +7,10 @@
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "Sampling/PCGExTexParamFactoryProvider.h"
 
+#if PCGEX_ENGINE_VERSION > 503
+#include "Engine/OverlapResult.h"
+#endif
+
 
 #define LOCTEXT_NAMESPACE "PCGExSampleSurfaceGuidedElement"
 #define PCGEX_NAMESPACE SampleSurfaceGuided
@@ -70,6 +74,15 @@ bool FPCGExSampleSurfaceGuidedElement::Boot(FPCGExContext* InContext) const
 		Context->bWriteUVCoords = false;
 	}
 
+	if (Settings->bWriteUVCoords && Settings->bUseTriangleBVH)
+	{
+		if (!Settings->bQuietUVSettingsWarning)
+		{
+			PCGE_LOG(Warning, GraphAndLog, FTEXT("UV Coords can't be sampled when using the triangle BVH."));
+		}
+		Context->bWriteUVCoords = false;
+	}
+
 	Context->CollisionSettings = Settings->CollisionSettings;
 	Context->CollisionSettings.Init(Context);
 
@@ -158,11 +171,147 @@ namespace PCGExSampleSurfaceGuided
 		}
 
 		World = Context->SourceComponent->GetWorld();
+
+		bUseTriangleBVH = Settings->bUseTriangleBVH;
+		if (bUseTriangleBVH)
+		{
+			// Find the bounds of all traces first, so candidates can be gathered in a single query
+
+			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, TraceBoundsTask)
+
+			TraceBoundsTask->OnPrepareSubLoopsCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+				{
+					PCGEX_ASYNC_THIS
+					This->TraceBounds = MakeShared<PCGExMT::TScopedValue<FBox>>(Loops, FBox(ForceInit));
+				};
+
+			TraceBoundsTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+
+					This->PointDataFacade->Fetch(Scope);
+
+					FBox& Bounds = This->TraceBounds->GetMutable(Scope);
+					FVector TraceOrigin;
+					FVector TraceDirection;
+					double TraceDistance;
+
+					for (int i = Scope.Start; i < Scope.End; i++)
+					{
+						This->GetTrace(i, TraceOrigin, TraceDirection, TraceDistance);
+						Bounds += TraceOrigin;
+						Bounds += TraceOrigin + TraceDirection * TraceDistance;
+					}
+				};
+
+			TraceBoundsTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->GatherTraceCandidates();
+					This->StartParallelLoopForPoints();
+				};
+
+			TraceBoundsTask->StartSubLoops(PointDataFacade->GetNum(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+			return true;
+		}
+
 		StartParallelLoopForPoints();
 
 		return true;
 	}
 
+	void FProcessor::GatherTraceCandidates()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSampleSurfaceGuided::GatherTraceCandidates);
+
+		const FBox Bounds = TraceBounds->Flatten([](const FBox& A, const FBox& B) { return A + B; });
+		TraceBounds.Reset();
+
+		if (!Bounds.IsValid) { return; }
+
+		FCollisionQueryParams CollisionParams;
+		Context->CollisionSettings.Update(CollisionParams);
+
+		const FCollisionShape CollisionShape = FCollisionShape::MakeBox(Bounds.GetExtent() + FVector(1));
+		TArray<FOverlapResult> Overlaps;
+
+		switch (Context->CollisionSettings.CollisionType)
+		{
+		case EPCGExCollisionFilterType::Channel:
+			World->OverlapMultiByChannel(Overlaps, Bounds.GetCenter(), FQuat::Identity, Context->CollisionSettings.CollisionChannel, CollisionShape, CollisionParams);
+			break;
+		case EPCGExCollisionFilterType::ObjectType:
+			World->OverlapMultiByObjectType(Overlaps, Bounds.GetCenter(), FQuat::Identity, FCollisionObjectQueryParams(Context->CollisionSettings.CollisionObjectType), CollisionShape, CollisionParams);
+			break;
+		case EPCGExCollisionFilterType::Profile:
+			World->OverlapMultiByProfile(Overlaps, Bounds.GetCenter(), FQuat::Identity, Context->CollisionSettings.CollisionProfileName, CollisionShape, CollisionParams);
+			break;
+		default:
+			break;
+		}
+
+		// Traces only stop on blocking responses, object type queries have no notion of it
+		const bool bBlockingOnly = Context->CollisionSettings.CollisionType != EPCGExCollisionFilterType::ObjectType;
+
+		TSet<UPrimitiveComponent*> Candidates;
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			if (bBlockingOnly && !Overlap.bBlockingHit) { continue; }
+			if (Context->bUseInclude && !Context->IncludedActors.Contains(Overlap.GetActor())) { continue; }
+			if (UPrimitiveComponent* Primitive = Overlap.GetComponent()) { Candidates.Add(Primitive); }
+		}
+
+		TriangleBVH = MakeShared<PCGExGeo::FTriangleBVH>();
+		for (UPrimitiveComponent* Primitive : Candidates) { if (!TriangleBVH->AddPrimitive(Primitive)) { FallbackPrimitives.Add(Primitive); } }
+
+		TriangleBVH->Build();
+		if (TriangleBVH->IsEmpty())
+		{
+			TriangleBVH.Reset();
+			return;
+		}
+
+		TriangleHits.SetNum(PointDataFacade->GetNum());
+	}
+
+	void FProcessor::TraceScope(const PCGExMT::FScope& Scope)
+	{
+		constexpr int32 PacketSize = PCGExGeo::FTriangleBVH::MaxPacketSize;
+
+		FVector Origins[PacketSize];
+		FVector Ends[PacketSize];
+		int32 Indices[PacketSize];
+		PCGExGeo::FTriangleHit Hits[PacketSize];
+		int32 NumRays = 0;
+
+		auto FlushPacket = [&]()
+		{
+			if (!NumRays) { return; }
+			TriangleBVH->RaycastPacket(MakeArrayView(Origins, NumRays), MakeArrayView(Ends, NumRays), MakeArrayView(Hits, NumRays));
+			for (int r = 0; r < NumRays; r++) { TriangleHits[Indices[r]] = Hits[r]; }
+			NumRays = 0;
+		};
+
+		FVector TraceDirection;
+		double TraceDistance;
+
+		for (int i = Scope.Start; i < Scope.End; i++)
+		{
+			if (!PointFilterCache[i]) { continue; }
+
+			GetTrace(i, Origins[NumRays], TraceDirection, TraceDistance);
+			Ends[NumRays] = Origins[NumRays] + TraceDirection * TraceDistance;
+			Indices[NumRays++] = i;
+
+			if (NumRays == PacketSize) { FlushPacket(); }
+		}
+
+		FlushPacket();
+	}
+
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
 	{
 		TPointsProcessor<FPCGExSampleSurfaceGuidedContext, UPCGExSampleSurfaceGuidedSettings>::PrepareLoopScopesForPoints(Loops);
@@ -173,13 +322,16 @@ namespace PCGExSampleSurfaceGuided
 	{
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
+
+		if (TriangleBVH) { TraceScope(Scope); }
 	}
 
 	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope)
 	{
-		const FVector Direction = DirectionGetter->Read(Index).GetSafeNormal();
-		const FVector Origin = OriginGetter->Read(Index);
-		const double MaxDistance = MaxDistanceGetter ? MaxDistanceGetter->Read(Index) : Settings->DistanceInput == EPCGExTraceSampleDistanceInput::Constant ? Settings->MaxDistance : Direction.Length();
+		FVector Origin;
+		FVector Direction;
+		double MaxDistance;
+		GetTrace(Index, Origin, Direction, MaxDistance);
 
 		auto SamplingFailed = [&]()
 		{
@@ -294,6 +446,42 @@ namespace PCGExSampleSurfaceGuided
 			}
 		};
 
+		if (bUseTriangleBVH)
+		{
+			const PCGExGeo::FTriangleHit* TriangleHit = TriangleBVH && TriangleHits[Index].Triangle != -1 ? &TriangleHits[Index] : nullptr;
+
+			// Remaining primitives only need to be traced up to the triangle hit
+			FVector TraceEnd = TriangleHit ? TriangleHit->Location : End;
+			bool bPrimitiveHit = false;
+
+			for (UPrimitiveComponent* Primitive : FallbackPrimitives)
+			{
+				if (FHitResult PrimitiveHitResult;
+					Primitive->LineTraceComponent(PrimitiveHitResult, Origin, TraceEnd, CollisionParams))
+				{
+					HitResult = PrimitiveHitResult;
+					TraceEnd = PrimitiveHitResult.ImpactPoint;
+					bPrimitiveHit = true;
+				}
+			}
+
+			if (!bPrimitiveHit && TriangleHit)
+			{
+				const PCGExGeo::FTriangleSurface& Surface = TriangleBVH->Surfaces[TriangleHit->Surface];
+				HitResult = FHitResult(Surface.Actor.Get(), Surface.Component.Get(), TriangleHit->Location, TriangleHit->Normal);
+				HitResult.FaceIndex = TriangleHit->FaceIndex;
+				HitResult.Distance = TriangleHit->Distance;
+				HitResult.TraceStart = Origin;
+				HitResult.TraceEnd = End;
+				HitResult.PhysMaterial = Surface.PhysMat;
+			}
+
+			if (bPrimitiveHit || TriangleHit) { ProcessTraceResult(); }
+			else { SamplingFailed(); }
+
+			return;
+		}
+
 		switch (Context->CollisionSettings.CollisionType)
 		{
 		case EPCGExCollisionFilterType::Channel:
@@ -0,0 +1,88 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Misc/AutomationTest.h"
+#include "PCGExMath.h"
+#include "Paths/Smoothing/PCGExMovingAverageSmoothing.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PCGExMovingAverageTests
+{
+	// Direct per-point windowed sum, same weights & wrapping as UPCGExMovingAverageSmoothing::SmoothSingle
+	static double Reference(const TArray<double>& Values, const int32 Index, const int32 W, const bool bClosedLoop, const bool bAverage)
+	{
+		const int32 NumPoints = Values.Num();
+		double Sum = 0;
+		double TotalWeight = 0;
+
+		for (int i = -W; i <= W; i++)
+		{
+			int32 j = Index + i;
+			if (bClosedLoop) { j = PCGExMath::Tile(j, 0, NumPoints - 1); }
+			else if (!FMath::IsWithin(j, 0, NumPoints)) { continue; }
+
+			const double Weight = bAverage ? 1 : 1 - static_cast<double>(FMath::Abs(i)) / W;
+			Sum += Values[j] * Weight;
+			TotalWeight += Weight;
+		}
+
+		return Sum / TotalWeight;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPCGExMovingAverageLongPathTest, "PCGEx.Paths.Smoothing.MovingAverage.LongPath", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FPCGExMovingAverageLongPathTest::RunTest(const FString& Parameters)
+{
+	// ~1m spacing with some wobble, long enough for global running sums to lose precision
+	constexpr int32 NumPoints = 500000;
+	constexpr double Tolerance = 1e-4;
+
+	TArray<double> Values;
+	Values.SetNumUninitialized(NumPoints);
+	for (int i = 0; i < NumPoints; i++) { Values[i] = i + 3 * FMath::Sin(i * 0.37); }
+
+	for (const int32 Window : {1, 3, 20, 5000})
+	{
+		TArray<int32> Windows;
+		Windows.Init(Window, NumPoints);
+
+		// A few points with a different window so chunks don't all share the same one
+		for (int i = 0; i < NumPoints; i += 7919) { Windows[i] = Window + 1; }
+
+		for (const bool bClosedLoop : {false, true})
+		{
+			for (const EPCGExDataBlendingType Blending : {EPCGExDataBlendingType::Average, EPCGExDataBlendingType::Weight})
+			{
+				const bool bAverage = Blending == EPCGExDataBlendingType::Average;
+
+				TArray<double> Smoothed;
+				Smoothed.SetNumZeroed(NumPoints);
+
+				PCGExMovingAverage::SmoothChannel<double>(
+					Blending, Windows, bClosedLoop,
+					[&](const int32 i) { return Values[i]; },
+					[&](const int32 i, const double V) { Smoothed[i] = V; });
+
+				double MaxError = 0;
+				auto Check = [&](const int32 i) { MaxError = FMath::Max(MaxError, FMath::Abs(Smoothed[i] - PCGExMovingAverageTests::Reference(Values, i, Windows[i], bClosedLoop, bAverage))); };
+
+				for (int i = 0; i < NumPoints; i += 997) { Check(i); }
+				for (int i = 0; i < 64; i++)
+				{
+					Check(i);
+					Check(NumPoints - 1 - i);
+				}
+
+				TestTrue(
+					FString::Printf(TEXT("Window %d, %s, %s : max error %f"), Window, bClosedLoop ? TEXT("closed") : TEXT("open"), bAverage ? TEXT("average") : TEXT("weight"), MaxError),
+					MaxError < Tolerance);
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -239,9 +239,7 @@ namespace PCGExBoundsAxisToPoints
 	{
 		if (!bGeneratePerPointData)
 		{
-			TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
-			UPCGMetadata* Metadata = PointDataFacade->GetOut()->Metadata;
-			for (int i = NumPoints; i < MutablePoints.Num(); i++) { Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry); }
+			PointDataFacade->Source->InitPoints(NumPoints);
 		}
 	}
 }
@@ -170,9 +170,7 @@ namespace PCGExBoundsToPoints
 	{
 		if (!bGeneratePerPointData && bSymmetry)
 		{
-			TArray<FPCGPoint>& MutablePoints = PointDataFacade->GetOut()->GetMutablePoints();
-			UPCGMetadata* Metadata = PointDataFacade->GetOut()->Metadata;
-			for (int i = NumPoints; i < MutablePoints.Num(); i++) { Metadata->InitializeOnSet(MutablePoints[i].MetadataEntry); }
+			PointDataFacade->Source->InitPoints(NumPoints);
 		}
 	}
 }
@@ -144,6 +144,10 @@ namespace PCGExData
 		{
 		}
 
+		virtual void Gather(const TArray<int32>& InReadIndices)
+		{
+		}
+
 		virtual bool IsScoped() { return bScopedBuffer; }
 		virtual bool IsWritable() PCGEX_NOT_IMPLEMENTED_RET(FBuffer::IsWritable, false)
 		virtual bool IsReadable() PCGEX_NOT_IMPLEMENTED_RET(FBuffer::IsReadable, false)
@@ -498,6 +502,17 @@ namespace PCGExData
 			//}
 		}
 
+		virtual void Gather(const TArray<int32>& InReadIndices) override
+		{
+			// Only output values follow the output points ; readers sourced from In keep their original layout
+			if (!OutValues) { return; }
+
+			PCGExMT::Gather(*OutValues.Get(), InReadIndices);
+
+			TArray<FPCGPoint>& OutPts = Source->GetMutablePoints();
+			OutPoints = MakeArrayView(OutPts.GetData(), OutPts.Num());
+		}
+
 		void Flush()
 		{
 			InValues.Reset();
@@ -730,6 +745,11 @@ namespace PCGExData
 			return Cloud;
 		}
 
+		/** Contiguous views of input point locations, rotations & world bounds. Materialized once and shared with every facade & cluster built on the same data. */
+		FORCEINLINE TConstArrayView<FVector> GetPositions() const { return Source->GetInPositions(); }
+		FORCEINLINE TConstArrayView<FQuat> GetRotations() const { return Source->GetInRotations(); }
+		FORCEINLINE TConstArrayView<FBox> GetBounds() const { return Source->GetInBounds(); }
+
 		const UPCGPointData* GetData(const ESource InSource) const { return Source->GetData(InSource); }
 		const UPCGPointData* GetIn() const { return Source->GetIn(); }
 		UPCGPointData* GetOut() const { return Source->GetOut(); }
@@ -749,6 +769,20 @@ namespace PCGExData
 
 		void Fetch(const PCGExMT::FScope& Scope) { for (const TSharedPtr<FBufferBase>& Buffer : Buffers) { Buffer->Fetch(Scope); } }
 
+		/**
+		 * Remove output points that don't pass CanKeep(Index), along with the matching values of every writable buffer.
+		 * Must be called before buffers are written. Returns the number of points left.
+		 */
+		template <typename FKeepFunc>
+		int32 Compact(FKeepFunc&& CanKeep)
+		{
+			TArray<int32> ReadIndices;
+			PCGExMT::GetCompactionIndices(ReadIndices, Source->GetNum(ESource::Out), CanKeep);
+			return Compact(ReadIndices);
+		}
+
+		int32 Compact(const TArray<int32>& InReadIndices);
+
 	protected:
 		template <typename Func>
 		void ForEachWritable(Func&& Callback)
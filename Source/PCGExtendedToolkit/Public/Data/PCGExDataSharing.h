@@ -8,6 +8,7 @@
 #include "PCGExSharedDataComponent.h"
 #include "PCGPin.h"
 #include "UObject/Object.h"
+#include <atomic>
 #include <functional>
 
 #include "PCGExDataSharing.generated.h"
@@ -66,6 +67,62 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSharedDataLookup
 	FName ItemId = FName("ItemId");
 };
 
+class UPCGExDataBucket;
+class UPCGExSharedDataManager;
+
+namespace PCGExDataSharing
+{
+	uint64 GetAccessStamp();
+
+	/** Per-item bookkeeping used to enforce the shared data memory budget */
+	struct FItemInfos
+	{
+		mutable std::atomic<uint64> LastAccess{0}; // Refreshed by concurrent readers under the shared content lock
+		int64 ResidentSize = 0;
+		FString SpillPath;            // Set when an on-disk copy matching the current content exists
+		TArray<int32> SpilledIndices; // Tagged data entries that currently only live on disk
+
+		FItemInfos() = default;
+
+		FItemInfos(const FItemInfos& Other)
+			: LastAccess(Other.LastAccess.load(std::memory_order_relaxed)),
+			  ResidentSize(Other.ResidentSize), SpillPath(Other.SpillPath), SpilledIndices(Other.SpilledIndices)
+		{
+		}
+
+		FItemInfos& operator=(const FItemInfos& Other)
+		{
+			LastAccess.store(Other.LastAccess.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			ResidentSize = Other.ResidentSize;
+			SpillPath = Other.SpillPath;
+			SpilledIndices = Other.SpilledIndices;
+			return *this;
+		}
+
+		bool IsSpilled() const { return !SpilledIndices.IsEmpty(); }
+		void Touch() const { LastAccess.store(GetAccessStamp(), std::memory_order_relaxed); }
+	};
+
+	struct FResidentItem
+	{
+		UPCGExDataBucket* Bucket = nullptr;
+		uint32 Item = 0;
+		uint64 LastAccess = 0;
+		int64 Size = 0;
+	};
+
+	int64 GetResidentSize(const FPCGDataCollection& InCollection);
+
+	FString GetSpillDirectory();
+	void DeleteSpillFile(FItemInfos& InInfos);
+
+	/** Write every point data of the collection to disk. Returns false if there was nothing to write. */
+	bool WriteToDisk(const FString& InPath, const FPCGDataCollection& InCollection, TArray<int32>& OutSpilledIndices);
+
+	/** Restore point data entries previously written with WriteToDisk into their original slot. */
+	bool ReadFromDisk(const FString& InPath, FPCGDataCollection& InOutCollection);
+}
+
 UCLASS(Hidden)
 class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExDataOwnedItem : public UObject
 {
@@ -94,6 +151,8 @@ public:
 	uint32 BucketId;
 	uint32 EventId;
 
+	TWeakObjectPtr<UPCGExSharedDataManager> Manager;
+
 	UPROPERTY(Transient)
 	TMap<uint32, FPCGDataCollection> Content;
 
@@ -105,8 +164,17 @@ public:
 
 	void Flush();
 
+	void GatherResidentItems(TArray<PCGExDataSharing::FResidentItem>& OutItems, int64& OutTotalSize) const;
+
+	/** Spill the item point data to disk and release it. Returns the amount of memory freed. */
+	int64 Evict(const uint32 Item);
+
 protected:
 	TMap<uint32, FPCGDataCollection> Data;
+	TMap<uint32, PCGExDataSharing::FItemInfos> Infos;
+
+	void OnContentChanged_Unsafe(const uint32 Item);
+	bool Rehydrate_Unsafe(const uint32 Item);
 
 	void OnUpdate(UPCGComponent* InSource, uint32 Item) const;
 };
@@ -119,6 +187,7 @@ class UPCGExSharedDataManager : public UObject
 	GENERATED_BODY()
 
 	mutable FRWLock BucketLock;
+	mutable FRWLock BudgetLock;
 
 public:
 	UPROPERTY(BlueprintAssignable, Category = "Events")
@@ -133,4 +202,7 @@ public:
 
 	void FlushBucket(uint32 BucketId);
 	void Flush();
+
+	/** Evict least recently used point data to disk until resident buckets fit in the configured memory budget. */
+	void EnforceMemoryBudget();
 };
@@ -62,6 +62,34 @@ namespace PCGExData
 		FORCEINLINE FPCGPoint& MutablePoint() const { return const_cast<FPCGPoint&>(*Point); }
 	};
 
+	/**
+	 * Struct-of-arrays copy of the members hot loops actually read, so they don't drag whole FPCGPoints through the cache.
+	 * Each array is materialized in parallel on first access, from input points that are expected to stay immutable.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FPointsCache : public TSharedFromThis<FPointsCache>
+	{
+		mutable FRWLock CacheLock;
+
+		const UPCGPointData* Data = nullptr;
+
+		TArray<FVector> Positions;
+		TArray<FQuat> Rotations;
+		TArray<FBox> Bounds;
+
+	public:
+		explicit FPointsCache(const UPCGPointData* InData):
+			Data(InData)
+		{
+		}
+
+		/** World-space point locations */
+		TConstArrayView<FVector> GetPositions();
+		/** World-space point rotations */
+		TConstArrayView<FQuat> GetRotations();
+		/** World-space point bounds, i.e local bounds transformed by the point transform */
+		TConstArrayView<FBox> GetBounds();
+	};
+
 	/**
 	 * 
 	 */
@@ -78,12 +106,14 @@ namespace PCGExData
 		mutable FRWLock PointsLock;
 		mutable FRWLock InKeysLock;
 		mutable FRWLock OutKeysLock;
+		mutable FRWLock OutKeysInitLock; // Serializes key initialization so it runs outside OutKeysLock
 		mutable FRWLock AttributesLock;
 
 		bool bWritten = false;
 		int32 NumInPoints = -1;
 
 		TSharedPtr<FPCGAttributeAccessorKeysPoints> InKeys; // Shared because reused by duplicates
+		TSharedPtr<FPointsCache> InPointsCache;          // Shared because reused by duplicates
 		TSharedPtr<FPCGAttributeAccessorKeysPoints> OutKeys;
 
 		const UPCGPointData* In = nullptr; // Input PointData	
@@ -194,6 +224,11 @@ namespace PCGExData
 		FORCEINLINE int32 GetOutInNum() const { return Out && !Out->GetPoints().IsEmpty() ? Out->GetPoints().Num() : In ? In->GetPoints().Num() : -1; }
 
 		TSharedPtr<FPCGAttributeAccessorKeysPoints> GetInKeys();
+		TSharedPtr<FPointsCache> GetInPointsCache();
+
+		FORCEINLINE TConstArrayView<FVector> GetInPositions() { return GetInPointsCache()->GetPositions(); }
+		FORCEINLINE TConstArrayView<FQuat> GetInRotations() { return GetInPointsCache()->GetRotations(); }
+		FORCEINLINE TConstArrayView<FBox> GetInBounds() { return GetInPointsCache()->GetBounds(); }
 		TSharedPtr<FPCGAttributeAccessorKeysPoints> GetOutKeys(const bool bEnsureValidKeys = false);
 		void PrintOutKeysMap(TMap<PCGMetadataEntryKey, int32>& InMap) const;
 
@@ -221,6 +256,15 @@ namespace PCGExData
 		FORCEINLINE void InitPoint(FPCGPoint& Point, const PCGMetadataEntryKey FromKey) const { Out->Metadata->InitializeOnSet(Point.MetadataEntry, FromKey, In->Metadata); }
 		FORCEINLINE void InitPoint(FPCGPoint& Point, const FPCGPoint& FromPoint) const { Out->Metadata->InitializeOnSet(Point.MetadataEntry, FromPoint.MetadataEntry, In->Metadata); }
 		FORCEINLINE void InitPoint(FPCGPoint& Point) const { Out->Metadata->InitializeOnSet(Point.MetadataEntry); }
+
+		/**
+		 * Bulk equivalent of InitPoint(Point) for a range of output points.
+		 * Points that need a new entry are gathered in parallel, all entries are allocated in a single metadata call,
+		 * parented to the entry the point was copied from (if any), and the new keys are then written back in parallel.
+		 * Attribute values are inherited through that parent mapping, the same way InitializeOnSet does.
+		 */
+		void InitPoints(const TArrayView<FPCGPoint>& Points) const;
+		void InitPoints(const int32 StartIndex = 0, const int32 Count = -1) const;
 		FORCEINLINE FPCGPoint& CopyPoint(const FPCGPoint& FromPoint, int32& OutIndex) const
 		{
 			FWriteScopeLock WriteLock(PointsLock);
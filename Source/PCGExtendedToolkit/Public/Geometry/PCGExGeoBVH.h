@@ -0,0 +1,97 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGEx.h"
+#include "PCGExMT.h"
+
+class UPrimitiveComponent;
+class UPhysicalMaterial;
+
+namespace PCGExGeo
+{
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FBVHNode
+	{
+		FBox Bounds = FBox(ForceInit);
+		int32 Start = 0; // First item if leaf, first child otherwise
+		int32 Count = 0; // Number of items if leaf, 0 otherwise
+	};
+
+	/**
+	 * Build a binary BVH over a set of item bounds, using binned SAH splitting.
+	 * Node bounds and binning are computed in parallel for large ranges, and large sibling subtrees are built side by side.
+	 * @param InItemBounds bounds of each item
+	 * @param OutNodes nodes, root first
+	 * @param OutOrder item indices in leaf order; leaves reference contiguous ranges of it
+	 */
+	void BuildBVH(const TArray<FBox>& InItemBounds, TArray<FBVHNode>& OutNodes, TArray<int32>& OutOrder);
+
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FTriangleSurface
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UPhysicalMaterial> PhysMat;
+	};
+
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FTriangleHit
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Normal = FVector::UpVector;
+		double Distance = 0;
+		int32 Triangle = -1;
+		int32 FaceIndex = -1; // Triangle index within its source mesh LOD
+		int32 Surface = -1;
+	};
+
+	/**
+	 * World-space triangle BVH built from static mesh components, queried on the CPU without touching the physics scene.
+	 * Register primitives with AddPrimitive, then call Build once; queries are thread-safe afterward.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FTriangleBVH : public TSharedFromThis<FTriangleBVH>
+	{
+	protected:
+		TArray<FVector> Vertices;
+		TArray<FIntVector3> Triangles;
+		TArray<int32> TriangleSurfaces;
+		TArray<int32> TriangleFaces;
+		TArray<FBVHNode> Nodes;
+
+	public:
+		static constexpr int32 MaxPacketSize = 16;
+
+		TArray<FTriangleSurface> Surfaces; // One per mesh section
+
+		FTriangleBVH() = default;
+
+		FORCEINLINE bool IsEmpty() const { return Nodes.IsEmpty(); }
+		FORCEINLINE int32 NumTriangles() const { return Triangles.Num(); }
+
+		/**
+		 * Extract the LOD0 triangles of a static mesh component (including all of its instances) in world space.
+		 * @return false if the primitive can't be represented, i.e it is not a static mesh or its geometry isn't CPU-accessible.
+		 */
+		bool AddPrimitive(UPrimitiveComponent* InPrimitive);
+
+		void Build();
+
+		/** Closest point on any triangle within MaxDistance of Origin */
+		bool FindClosest(const FVector& Origin, const double MaxDistance, FTriangleHit& OutHit) const;
+
+		/** Closest double-sided triangle hit along the segment Origin -> End */
+		bool Raycast(const FVector& Origin, const FVector& End, FTriangleHit& OutHit) const;
+
+		/**
+		 * Trace up to MaxPacketSize segments in a single traversal; nodes are visited once for all rays that may still hit them.
+		 * Misses are reported with a Triangle index of -1.
+		 */
+		void RaycastPacket(const TConstArrayView<FVector> Origins, const TConstArrayView<FVector> Ends, const TArrayView<FTriangleHit> OutHits) const;
+
+		FORCEINLINE FVector GetTriangleNormal(const int32 Index) const
+		{
+			const FIntVector3& T = Triangles[Index];
+			return FVector::CrossProduct(Vertices[T.Z] - Vertices[T.X], Vertices[T.Y] - Vertices[T.X]).GetSafeNormal();
+		}
+	};
+}
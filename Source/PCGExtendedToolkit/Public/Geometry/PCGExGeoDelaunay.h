@@ -262,7 +262,7 @@ namespace PCGExGeo
 			IsValid = false;
 		}
 
-		template <bool bComputeAdjacency = false, bool bComputeHull = false>
+		template <bool bComputeAdjacency = false, bool bComputeHull = false, bool bComputeEdges = true>
 		bool Process(const TArrayView<FVector>& Positions)
 		{
 			Clear();
@@ -281,9 +281,18 @@ namespace PCGExGeo
 			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
 
 			const int32 NumSites = Tetrahedra.Num();
+
+			if constexpr (!bComputeAdjacency && !bComputeHull && !bComputeEdges)
+			{
+				// Sites only, no shared state to update
+				Sites.SetNumUninitialized(NumSites);
+				PCGExMT::ParallelForBlocking(NumSites, [&](const int32 i) { Sites[i] = FDelaunaySite3(Tetrahedra[i], i); });
+				return IsValid;
+			}
+
 			const int32 NumReserve = NumSites * 3;
 
-			DelaunayEdges.Reserve(NumReserve);
+			if constexpr (bComputeEdges) { DelaunayEdges.Reserve(NumReserve); }
 
 			TSet<uint32> FacesUsage;
 			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
@@ -297,11 +306,14 @@ namespace PCGExGeo
 				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
 				FDelaunaySite3& Site = Sites[i];
 
-				for (int a = 0; a < 4; a++)
+				if constexpr (bComputeEdges)
 				{
-					for (int b = a + 1; b < 4; b++)
+					for (int a = 0; a < 4; a++)
 					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
+						for (int b = a + 1; b < 4; b++)
+						{
+							DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
+						}
 					}
 				}
 
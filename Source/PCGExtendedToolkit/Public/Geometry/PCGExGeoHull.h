@@ -0,0 +1,38 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGEx.h"
+#include "PCGExMT.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Orientation of C relative to the directed line A->B, positive if counter-clockwise.
+	 * Uses a floating-point filter and only falls back to the exact predicate when the result is within rounding error.
+	 */
+	double Orient2D(const FVector2D& A, const FVector2D& B, const FVector2D& C);
+
+	/**
+	 * Compute the 2D convex hull of a set of positions.
+	 * Points inside the extreme octagon are culled first, then the survivors are split in chunks whose hulls are computed in parallel,
+	 * and the chunk hulls are merged until a single chunk remains.
+	 * @param InPositions positions to compute the hull of
+	 * @param OutHull hull vertex indices, counter-clockwise, collinear points excluded
+	 * @return false if the hull is degenerate
+	 */
+	bool ConvexHull2D(const TArrayView<const FVector2D>& InPositions, TArray<int32>& OutHull);
+
+	/**
+	 * Compute the 3D convex hull of a set of positions.
+	 * Positions are split in chunks whose hulls are computed in parallel, and only chunk hull vertices are kept for the next pass,
+	 * until a single chunk remains.
+	 * @param InPositions positions to compute the hull of
+	 * @param OutEdges unique hull edges, as H64U of position indices
+	 * @param OutHullVertices hull vertex indices, sorted
+	 * @return false if the hull is degenerate (i.e all points are coplanar)
+	 */
+	bool ConvexHull3D(const TArrayView<const FVector>& InPositions, TArray<uint64>& OutEdges, TArray<int32>& OutHullVertices);
+}
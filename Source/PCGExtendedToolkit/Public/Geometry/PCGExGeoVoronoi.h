@@ -115,7 +115,7 @@ namespace PCGExGeo
 	{
 	public:
 		TUniquePtr<TDelaunay3> Delaunay;
-		TSet<uint64> VoronoiEdges;
+		TArray<uint64> VoronoiEdges;
 		TSet<int32> VoronoiHull;
 		TArray<FSphere> Circumspheres;
 		TArray<FVector> Centroids;
@@ -133,6 +133,7 @@ namespace PCGExGeo
 		void Clear()
 		{
 			Delaunay.Reset();
+			VoronoiEdges.Empty();
 			Centroids.Empty();
 			IsValid = false;
 		}
@@ -142,39 +143,135 @@ namespace PCGExGeo
 			IsValid = false;
 			Delaunay = MakeUnique<TDelaunay3>();
 
-			if (!Delaunay->Process<true, false>(Positions))
+			if (!Delaunay->Process<false, false, false>(Positions))
 			{
 				Clear();
 				return IsValid;
 			}
 
 			const int32 NumSites = Delaunay->Sites.Num();
-			PCGEx::InitArray(Circumspheres, NumSites);
-			PCGEx::InitArray(Centroids, NumSites);
+			Circumspheres.SetNumUninitialized(NumSites);
+			Centroids.SetNumUninitialized(NumSites);
+
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(GeoVoronoi::ComputeCells);
+
+				PCGExMT::ParallelForBlocking(
+					NumSites, [&](const int32 i)
+					{
+						const FDelaunaySite3& Site = Delaunay->Sites[i];
+						FindSphereFrom4Points(Positions, Site.Vtx, Circumspheres[i]);
+						GetCentroid(Positions, Site.Vtx, Centroids[i]);
+					});
+			}
 
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(GeoVoronoi::FindVoronoiEdges);
+				FindVoronoiEdges();
+			}
 
-				for (FDelaunaySite3& Site : Delaunay->Sites)
+			IsValid = true;
+			return IsValid;
+		}
+
+	protected:
+		/**
+		 * Two sites are connected if they share a face.
+		 * Faces are sorted by their first edge, then matched on their last vertex within each run of identical edges.
+		 * Site vertices are sorted, so each face triplet is sorted as well and its first edge is a stable key.
+		 */
+		void FindVoronoiEdges()
+		{
+			const TArray<FDelaunaySite3>& Sites = Delaunay->Sites;
+			const int32 NumFaces = Sites.Num() * 4;
+
+			TArray<uint64> FaceKeys;
+			TArray<int32> FaceIndices;
+			FaceKeys.SetNumUninitialized(NumFaces);
+			FaceIndices.SetNumUninitialized(NumFaces);
+
+			PCGExMT::ParallelForBlocking(
+				NumFaces, [&](const int32 i)
 				{
-					FindSphereFrom4Points(Positions, Site.Vtx, Circumspheres[Site.Id]);
-					GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-				}
+					const int32* Vtx = Sites[i / 4].Vtx;
+					const int32* Face = MTX[i % 4];
+					FaceKeys[i] = PCGEx::H64(Vtx[Face[0]], Vtx[Face[1]]);
+					FaceIndices[i] = i;
+				});
+
+			PCGExMT::RadixSort(FaceKeys, FaceIndices);
 
-				for (const TPair<uint32, uint64>& AdjacencyPair : Delaunay->Adjacency)
+			auto GetLastVtx = [&](const int32 FaceIndex) { return Sites[FaceIndex / 4].Vtx[MTX[FaceIndex % 4][2]]; };
+
+			// Scopes are snapped to run boundaries so a run is never split
+			TArray<PCGExMT::FScope> Scopes;
+			const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumFaces, PCGExMT::CompactionScopeSize);
+
+			TArray<int32> RunStarts;
+			RunStarts.SetNumUninitialized(NumScopes + 1);
+			RunStarts[NumScopes] = NumFaces;
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
 				{
-					int32 A = -1;
-					int32 B = -1;
-					PCGEx::NH64(AdjacencyPair.Value, A, B);
+					int32 Start = Scopes[ScopeIndex].Start;
+					while (Start > 0 && Start < NumFaces && FaceKeys[Start] == FaceKeys[Start - 1]) { Start++; }
+					RunStarts[ScopeIndex] = Start;
+				});
 
-					if (A == -1 || B == -1) { continue; }
+			auto ForEachSharedFace = [&](const int32 ScopeIndex, auto&& Func)
+			{
+				const int32 End = FMath::Max(RunStarts[ScopeIndex], RunStarts[ScopeIndex + 1]);
+				int32 RunStart = RunStarts[ScopeIndex];
 
-					VoronoiEdges.Add(PCGEx::H64U(A, B));
+				while (RunStart < End)
+				{
+					int32 RunEnd = RunStart + 1;
+					while (RunEnd < NumFaces && FaceKeys[RunEnd] == FaceKeys[RunStart]) { RunEnd++; }
+
+					// Runs are short (faces around a single edge), a face is shared by at most two sites
+					for (int32 i = RunStart; i < RunEnd; i++)
+					{
+						const int32 C = GetLastVtx(FaceIndices[i]);
+						for (int32 j = i + 1; j < RunEnd; j++)
+						{
+							if (GetLastVtx(FaceIndices[j]) != C) { continue; }
+							Func(FaceIndices[i] / 4, FaceIndices[j] / 4);
+							break;
+						}
+					}
+
+					RunStart = RunEnd;
 				}
+			};
+
+			TArray<int32> Offsets;
+			Offsets.SetNumUninitialized(NumScopes);
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					int32 Count = 0;
+					ForEachSharedFace(ScopeIndex, [&](const int32 A, const int32 B) { Count++; });
+					Offsets[ScopeIndex] = Count;
+				});
+
+			int32 NumEdges = 0;
+			for (int32& Offset : Offsets)
+			{
+				const int32 Count = Offset;
+				Offset = NumEdges;
+				NumEdges += Count;
 			}
 
-			IsValid = true;
-			return IsValid;
+			VoronoiEdges.SetNumUninitialized(NumEdges);
+
+			PCGExMT::ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					int32 WriteIndex = Offsets[ScopeIndex];
+					ForEachSharedFace(ScopeIndex, [&](const int32 A, const int32 B) { VoronoiEdges[WriteIndex++] = PCGEx::H64U(A, B); });
+				});
 		}
 	};
 }
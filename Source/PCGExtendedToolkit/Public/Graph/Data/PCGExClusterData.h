@@ -72,6 +72,45 @@ protected:
 
 namespace PCGExClusterData
 {
+	/** Hash of vtx positions & packed vtx identifiers. */
+	PCGEXTENDEDTOOLKIT_API uint64 ComputeVtxContentHash(const TSharedRef<PCGExData::FPointIO>& VtxIO);
+
+	/** Hash of edges endpoints. Returns 0 if the edges are not cluster-friendly. */
+	PCGEXTENDEDTOOLKIT_API uint64 ComputeEdgesContentHash(const TSharedRef<PCGExData::FPointIO>& EdgesIO);
+
+	/**
+	 * Process-wide cache of built clusters, keyed by the content hash of their vtx/edges data.
+	 * Cached clusters are treated as read-only templates and are only ever consumed through mirrors.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FClusterCache
+	{
+		struct FEntry
+		{
+			TSharedPtr<PCGExCluster::FCluster> Cluster;
+			uint64 VtxHash = 0;
+			uint64 EdgesHash = 0;
+			FBox VtxBounds = FBox(ForceInit);
+			int64 Size = 0;
+			uint64 LastAccess = 0;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<uint64, FEntry> Entries;
+		int64 TotalSize = 0;
+		uint64 AccessCounter = 0;
+
+		void EnforceBudget_Unsafe(const int64 Budget);
+		static uint64 MakeKey(const uint64 VtxHash, const uint64 EdgesHash);
+		static FBox GetVtxBounds(const TSharedRef<PCGExData::FPointIO>& VtxIO);
+
+	public:
+		static FClusterCache& Get();
+
+		TSharedPtr<PCGExCluster::FCluster> Find(const uint64 VtxHash, const uint64 EdgesHash, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO);
+		void Add(const uint64 VtxHash, const uint64 EdgesHash, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedPtr<PCGExCluster::FCluster>& InCluster);
+		void Flush();
+	};
+
 	static TSharedPtr<PCGExCluster::FCluster> TryGetCachedCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO)
 	{
 		if (GetDefault<UPCGExGlobalSettings>()->bCacheClusters)
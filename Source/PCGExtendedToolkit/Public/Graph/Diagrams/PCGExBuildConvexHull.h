@@ -7,7 +7,7 @@
 #include "PCGExPointsProcessor.h"
 
 
-#include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 
 
 #include "PCGExBuildConvexHull.generated.h"
@@ -71,11 +71,8 @@ namespace PCGExConvexHull
 	{
 	protected:
 		TSharedPtr<TArray<int32>> OutputIndices;
-		TUniquePtr<PCGExGeo::TDelaunay3> Delaunay;
 		TSharedPtr<PCGExGraph::FGraphBuilder> GraphBuilder;
 
-		TArray<uint64> Edges;
-
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -83,7 +80,6 @@ namespace PCGExConvexHull
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
-		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
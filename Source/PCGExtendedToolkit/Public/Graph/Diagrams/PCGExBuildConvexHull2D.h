@@ -8,7 +8,7 @@
 
 
 #include "Geometry/PCGExGeo.h"
-#include "Geometry/PCGExGeoDelaunay.h"
+#include "Geometry/PCGExGeoHull.h"
 #include "PCGExBuildConvexHull2D.generated.h"
 
 /**
@@ -80,11 +80,8 @@ namespace PCGExConvexHull2D
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
 		TSharedPtr<TArray<int32>> OutputIndices;
-		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay;
 		TSharedPtr<PCGExGraph::FGraphBuilder> GraphBuilder;
 
-		TArray<uint64> Edges;
-
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -92,7 +89,6 @@ namespace PCGExConvexHull2D
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
-		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
@@ -112,7 +112,6 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExBreakClustersToPathsContext final : FPCG
 	friend class FPCGExBreakClustersToPathsElement;
 
 	TSharedPtr<PCGExData::FPointIOCollection> Paths;
-	TArray<TSharedPtr<PCGExCluster::FNodeChain>> Chains;
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExBreakClustersToPathsElement final : public FPCGExEdgesProcessorElement
@@ -9,29 +9,23 @@
 
 namespace PCGExCluster
 {
-	class /*PCGEXTENDEDTOOLKIT_API*/ FNodeChain : public TSharedFromThis<FNodeChain>
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FNodeChain
 	{
-	public:
 		FLink Seed;
 		int32 SingleEdge = -1;
 
 		bool bIsClosedLoop = false;
 		bool bIsLeaf = false;
 
-		uint64 UniqueHash = 0;
-		TArray<FLink> Links; // {Seed} [Edge <- Node][Edge <- Node] // Seed hold edge index that wrap if closed loop.
+		int32 LinksStart = 0; // First link in the builder's link array
+		int32 NumLinks = 0;   // {Seed} [Edge <- Node][Edge <- Node] // Seed hold edge index that wrap if closed loop.
+
+		FNodeChain() = default;
 
 		explicit FNodeChain(const FLink InSeed)
 			: Seed(InSeed)
 		{
 		}
-
-		~FNodeChain() = default;
-		void FixUniqueHash();
-
-		void BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints);
-		void Dump(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
-		void DumpReduced(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FNodeChainBuilder : public TSharedFromThis<FNodeChainBuilder>
@@ -39,7 +33,8 @@ namespace PCGExCluster
 	public:
 		TSharedRef<FCluster> Cluster;
 		TSharedPtr<TArray<int8>> Breakpoints;
-		TArray<TSharedPtr<FNodeChain>> Chains;
+		TArray<FNodeChain> Chains;
+		TArray<FLink> Links; // Links of all chains, each chain owns a contiguous range
 
 		FNodeChainBuilder(const TSharedRef<FCluster>& InCluster)
 			: Cluster(InCluster)
@@ -49,8 +44,30 @@ namespace PCGExCluster
 		bool Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 		bool CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 
+		FORCEINLINE TConstArrayView<FLink> GetLinks(const FNodeChain& Chain) const { return MakeArrayView(Links.GetData() + Chain.LinksStart, Chain.NumLinks); }
+		FORCEINLINE const FLink& GetLastLink(const FNodeChain& Chain) const { return Links[Chain.LinksStart + Chain.NumLinks - 1]; }
+
+		void Dump(const FNodeChain& Chain, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
+		void DumpReduced(const FNodeChain& Chain, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
+
 	protected:
+		struct FWalk
+		{
+			FNodeChain Chain;
+			int32 ScopeIndex = -1; // Scope whose link buffer holds the walked links, -1 if no chain was walked for this seed
+			bool bReverse = false; // Walked from the other end
+		};
+
+		TArray<FLink> Seeds;
+		TArray<int32> SeedOffsets; // First seed of each node, -1 if the node isn't seeded
+		TArray<int32> EdgeOwners;  // Seed that claimed each edge, -1 if unclaimed
+		TArray<FWalk> Walks;       // Walks, stored in the slot of the lowest seed of each chain
+		TArray<TArray<FLink>> ScopeLinks;
+
+		void AddSeeds(const FNode* Node, const bool bLeavesOnly);
 		bool DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
-		void Dedupe();
+		void WalkChain(const int32 SeedIndex, const int32 ScopeIndex);
+		int32 GetSeedIndex(const int32 NodeIndex, const int32 EdgeIndex) const;
+		void Gather();
 	};
 }
@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -157,6 +157,12 @@ namespace PCGExCluster
 		         const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup,
 		         bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
+		/**
+		 * Lightweight instance sharing this cluster's topology (nodes, edges & lookup), meant to be bound to transformed copies of its data.
+		 * Positions and edge bounds are not carried over ; they are materialized by mirrors built from the instance.
+		 */
+		TSharedPtr<FCluster> MakeInstance(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO);
+
 		void ClearInheritedForChanges(const bool bClearOwned = false);
 		void WillModifyVtxIO(const bool bClearOwned = false);
 		void WillModifyVtxPositions(const bool bClearOwned = false);
@@ -164,7 +170,7 @@ namespace PCGExCluster
 		~FCluster();
 
 		bool BuildFrom(
-			const TMap<uint32, int32>& InEndpointsLookup,
+			const PCGExGraph::FEndpointsLookup& InEndpointsLookup,
 			const TArray<int32>* InExpectedAdjacency,
 			const PCGExData::ESource PointsSource = PCGExData::ESource::In);
 
@@ -516,7 +522,7 @@ namespace PCGExCluster
 		void UpdatePositions();
 
 	protected:
-		FORCEINLINE int32 GetOrCreateNode_Unsafe(const TArray<FPCGPoint>& InNodePoints, const int32 PointIndex)
+		FORCEINLINE int32 GetOrCreateNode_Unsafe(const TConstArrayView<FVector>& InPositions, const int32 PointIndex)
 		{
 			int32 NodeIndex = NodeIndexLookup->Get(PointIndex);
 
@@ -525,7 +531,7 @@ namespace PCGExCluster
 			NodeIndex = Nodes->Add(FNode(Nodes->Num(), PointIndex));
 			NodeIndexLookup->GetMutable(PointIndex) = NodeIndex;
 
-			const FVector Pos = InNodePoints[PointIndex].Transform.GetLocation();
+			const FVector Pos = InPositions[PointIndex];
 			NodePositions.Add(Pos);
 			Bounds += Pos;
 
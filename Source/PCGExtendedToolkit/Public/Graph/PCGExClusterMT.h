@@ -1,4 +1,4 @@
-// Copyright 2025 Timothé Lapetite and contributors
+﻿// Copyright 2025 Timothé Lapetite and contributors
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -81,6 +81,8 @@ namespace PCGExClusterMT
 				false, false, false);
 		}
 
+		uint64 GetVtxContentHash() const;
+
 		void ForwardCluster() const
 		{
 			if (UPCGExClusterEdgesData* EdgesData = Cast<UPCGExClusterEdgesData>(EdgeDataFacade->GetOut()))
@@ -109,11 +111,14 @@ namespace PCGExClusterMT
 
 		int32 BatchIndex = -1;
 
-		TMap<uint32, int32>* EndpointsLookup = nullptr;
+		PCGExGraph::FEndpointsLookup* EndpointsLookup = nullptr;
 		TArray<int32>* ExpectedAdjacency = nullptr;
 
 		TSharedPtr<PCGExCluster::FCluster> Cluster;
 
+		TSharedPtr<PCGExCluster::FCluster> PersistentCluster; // Persistent cache hit resolved by the batch
+		uint64 EdgesContentHash = 0;                          // Set by the batch when the persistent cache is in use
+
 		TSharedPtr<PCGExGraph::FGraphBuilder> GraphBuilder;
 
 		FClusterProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
@@ -168,17 +173,35 @@ namespace PCGExClusterMT
 				Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
 			}
 
-			if (!Cluster)
+			if (!Cluster && PersistentCluster)
 			{
-				Cluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
+				// Identical cluster built by a previous execution
+				Cluster = HandleCachedCluster(PersistentCluster.ToSharedRef());
 				Cluster->bIsOneToOne = bIsOneToOne;
+			}
 
-				if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+			if (!Cluster)
+			{
+				TSharedPtr<PCGExCluster::FCluster> NewCluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
+				NewCluster->bIsOneToOne = bIsOneToOne;
+
+				if (!NewCluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
 				{
 					PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
-					Cluster.Reset();
 					return false;
 				}
+
+				if (EdgesContentHash)
+				{
+					// The freshly built cluster becomes a read-only template; work on a mirror like any other cached cluster
+					PCGExClusterData::FClusterCache::Get().Add(GetVtxContentHash(), EdgesContentHash, VtxDataFacade->Source, NewCluster);
+					Cluster = HandleCachedCluster(NewCluster.ToSharedRef());
+					Cluster->bIsOneToOne = bIsOneToOne;
+				}
+				else
+				{
+					Cluster = NewCluster;
+				}
 			}
 
 			NumNodes = Cluster->Nodes->Num();
@@ -350,12 +373,15 @@ namespace PCGExClusterMT
 		TSharedPtr<PCGExMT::FTaskManager> AsyncManager;
 		TSharedPtr<PCGExData::FFacadePreloader> VtxFacadePreloader;
 
-		const FPCGMetadataAttribute<int64>* RawLookupAttribute = nullptr;
-		TArray<uint32> ReverseLookup;
-
-		TMap<uint32, int32> EndpointsLookup;
+		PCGExGraph::FEndpointsLookup EndpointsLookup;
 		TArray<int32> ExpectedAdjacency;
 
+		bool bVtxContentHashComputed = false;
+		uint64 VtxContentHash = 0;
+
+		TArray<TSharedPtr<PCGExCluster::FCluster>> PersistentClusters;
+		TArray<uint64> EdgesContentHashes;
+
 		bool bPreparationSuccessful = false;
 		bool bRequiresHeuristics = false;
 		bool bRequiresGraphBuilder = false;
@@ -371,6 +397,7 @@ namespace PCGExClusterMT
 
 		bool bSkipCompletion = false;
 		bool bRequiresWriteStep = false;
+		bool bUsePersistentClusterCache = true; // Disable when processors don't build clusters; they may rely on the endpoints lookup
 		bool bWriteVtxDataFacade = false;
 
 		TArray<TSharedPtr<PCGExData::FPointIO>> Edges;
@@ -383,6 +410,50 @@ namespace PCGExClusterMT
 
 		virtual int32 GetNumProcessors() const { return -1; }
 
+		/** Lazily computed content hash of the vtx data, shared by all processors of this batch. */
+		uint64 GetVtxContentHash()
+		{
+			{
+				FReadScopeLock ReadScopeLock(BatchLock);
+				if (bVtxContentHashComputed) { return VtxContentHash; }
+			}
+			{
+				FWriteScopeLock WriteScopeLock(BatchLock);
+				if (!bVtxContentHashComputed)
+				{
+					VtxContentHash = PCGExClusterData::ComputeVtxContentHash(VtxDataFacade->Source);
+					bVtxContentHashComputed = true;
+				}
+				return VtxContentHash;
+			}
+		}
+
+		/**
+		 * Look up every edge set in the persistent cluster cache.
+		 * Returns true if each of them already has a usable cluster, in which case the endpoints lookup isn't needed.
+		 */
+		bool ResolvePersistentClusters()
+		{
+			PersistentClusters.Init(nullptr, Edges.Num());
+			EdgesContentHashes.Init(0, Edges.Num());
+
+			const uint64 VtxHash = GetVtxContentHash();
+			if (!VtxHash) { return false; }
+
+			bool bAllResolved = true;
+			for (int i = 0; i < Edges.Num(); i++)
+			{
+				const TSharedRef<PCGExData::FPointIO> EdgesIO = Edges[i].ToSharedRef();
+				if (PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgesIO)) { continue; }
+
+				EdgesContentHashes[i] = PCGExClusterData::ComputeEdgesContentHash(EdgesIO);
+				PersistentClusters[i] = PCGExClusterData::FClusterCache::Get().Find(VtxHash, EdgesContentHashes[i], VtxDataFacade->Source, EdgesIO);
+				if (!PersistentClusters[i]) { bAllResolved = false; }
+			}
+
+			return bAllResolved;
+		}
+
 		bool PreparationSuccessful() const { return bPreparationSuccessful; }
 		bool RequiresGraphBuilder() const { return bRequiresGraphBuilder; }
 		bool RequiresHeuristics() const { return bRequiresHeuristics; }
@@ -424,69 +495,20 @@ namespace PCGExClusterMT
 			const int32 NumVtx = VtxDataFacade->GetNum();
 			NodeIndexLookup = MakeShared<PCGEx::FIndexLookup>(NumVtx);
 
-			if (!bScopedIndexLookupBuild || NumVtx < GetDefault<UPCGExGlobalSettings>()->SmallClusterSize)
-			{
-				// Trivial
-				PCGExGraph::BuildEndpointsLookup(VtxDataFacade->Source, EndpointsLookup, ExpectedAdjacency);
-				if (RequiresGraphBuilder())
-				{
-					GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(VtxDataFacade, &GraphBuilderDetails, 6);
-					GraphBuilder->SourceEdgeFacades = EdgesDataFacades;
-				}
-
-				OnProcessingPreparationComplete();
-			}
-			else
-			{
-				// Spread
-				PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManagerPtr, BuildEndpointLookupTask)
-
-				PCGEx::InitArray(ReverseLookup, NumVtx);
-				PCGEx::InitArray(ExpectedAdjacency, NumVtx);
-
-				RawLookupAttribute = VtxDataFacade->GetIn()->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Attr_PCGExVtxIdx);
-				if (!RawLookupAttribute) { return; } // FAIL
-
-				BuildEndpointLookupTask->OnCompleteCallback =
-					[PCGEX_ASYNC_THIS_CAPTURE]()
-					{
-						TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable::Complete);
-
-						PCGEX_ASYNC_THIS
-
-						const int32 Num = This->VtxDataFacade->GetNum();
-						This->EndpointsLookup.Reserve(Num);
-						for (int i = 0; i < Num; i++) { This->EndpointsLookup.Add(This->ReverseLookup[i], i); }
-						This->ReverseLookup.Empty();
-
-						if (This->RequiresGraphBuilder())
-						{
-							This->GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(This->VtxDataFacade, &This->GraphBuilderDetails, 6);
-							This->GraphBuilder->SourceEdgeFacades = This->EdgesDataFacades;
-						}
+			// Resolve persistent cache hits first so a batch where every cluster is a hit skips the endpoints lookup entirely
+			const bool bAllClustersCached = bUsePersistentClusterCache && GetDefault<UPCGExGlobalSettings>()->UsePersistentClusterCache() && ResolvePersistentClusters();
 
-						This->OnProcessingPreparationComplete();
-					};
-
-				BuildEndpointLookupTask->OnSubLoopStartCallback =
-					[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
-					{
-						TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable::Range);
-
-						PCGEX_ASYNC_THIS
-						const TArray<FPCGPoint>& InKeys = This->VtxDataFacade->GetIn()->GetPoints();
-						for (int i = Scope.Start; i < Scope.End; i++)
-						{
-							uint32 A;
-							uint32 B;
-							PCGEx::H64(This->RawLookupAttribute->GetValueFromItemKey(InKeys[i].MetadataEntry), A, B);
+			// The endpoints lookup is built in parallel internally once large enough,
+			// bScopedIndexLookupBuild is kept for compatibility but no longer needs a dedicated task.
+			if (!bAllClustersCached) { PCGExGraph::BuildEndpointsLookup(VtxDataFacade->Source, EndpointsLookup, ExpectedAdjacency); }
 
-							This->ReverseLookup[i] = A;
-							This->ExpectedAdjacency[i] = B;
-						}
-					};
-				BuildEndpointLookupTask->StartSubLoops(VtxDataFacade->GetNum(), 4096);
+			if (RequiresGraphBuilder())
+			{
+				GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(VtxDataFacade, &GraphBuilderDetails, 6);
+				GraphBuilder->SourceEdgeFacades = EdgesDataFacades;
 			}
+
+			OnProcessingPreparationComplete();
 		}
 
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader)
@@ -558,6 +580,12 @@ namespace PCGExClusterMT
 		}
 	};
 
+	inline uint64 FClusterProcessor::GetVtxContentHash() const
+	{
+		const TSharedPtr<FClusterProcessorBatchBase> PinnedBatch = ParentBatch.Pin();
+		return PinnedBatch ? PinnedBatch->GetVtxContentHash() : PCGExClusterData::ComputeVtxContentHash(VtxDataFacade->Source);
+	}
+
 	template <typename T>
 	class TBatch : public FClusterProcessorBatchBase
 	{
@@ -599,8 +627,9 @@ namespace PCGExClusterMT
 			CurrentState.store(PCGEx::State_Processing, std::memory_order_release);
 			TSharedPtr<FClusterProcessorBatchBase> SelfPtr = SharedThis(this);
 
-			for (const TSharedPtr<PCGExData::FPointIO>& IO : Edges)
+			for (int i = 0; i < Edges.Num(); i++)
 			{
+				const TSharedPtr<PCGExData::FPointIO>& IO = Edges[i];
 				const TSharedPtr<T> NewProcessor = MakeShared<T>(VtxDataFacade, (*EdgesDataFacades)[IO->IOIndex]);
 
 				NewProcessor->SetExecutionContext(ExecutionContext);
@@ -610,6 +639,12 @@ namespace PCGExClusterMT
 				NewProcessor->ExpectedAdjacency = &ExpectedAdjacency;
 				NewProcessor->BatchIndex = Processors.Num();
 
+				if (EdgesContentHashes.IsValidIndex(i))
+				{
+					NewProcessor->PersistentCluster = PersistentClusters[i];
+					NewProcessor->EdgesContentHash = EdgesContentHashes[i];
+				}
+
 				if (RequiresGraphBuilder()) { NewProcessor->GraphBuilder = GraphBuilder; }
 				NewProcessor->SetRequiresHeuristics(RequiresHeuristics(), HeuristicsFactories);
 
@@ -98,12 +98,25 @@ namespace PCGExConnectPoints
 		TArray<UPCGExProbeOperation*> SharedProbeOperations;
 		bool bUseVariableRadius = false;
 		int32 NumChainedOps = 0;
+		int32 NumSortedCandidates = -1;
 		double SharedSearchRadius = 0;
 
 		TArray<int8> CanGenerate;
 		TArray<int8> AcceptConnections;
 		TUniquePtr<PCGEx::FIndexedItemOctree> Octree;
 
+		// Uniform grid with cells the size of the shared search radius, used instead of the octree when the radius is constant.
+		// Connectable points are bucketed per cell, with positions stored as SoA lanes.
+		bool bUseGrid = false;
+		double GridInvCellSize = 0;
+		FVector GridOrigin = FVector::ZeroVector;
+		FIntVector GridDims = FIntVector::ZeroValue;
+		TArray<int32> GridCellStarts;
+		TArray<int32> GridPointIndices;
+		TArray<double> GridX;
+		TArray<double> GridY;
+		TArray<double> GridZ;
+
 		const TArray<FPCGPoint>* InPoints = nullptr;
 		TArray<FTransform> CachedTransforms;
 
@@ -125,6 +138,7 @@ namespace PCGExConnectPoints
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		void OnPreparationComplete();
+		bool BuildGrid();
 		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
@@ -38,6 +38,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ShowOnlyInnerProperties))
 	FPCGExTransformDetails TransformDetails;
 
+	/** Build each input cluster once and bind a lightweight instance of its topology to every copy, so downstream cluster nodes don't have to rebuild them. Requires cluster caching to be enabled. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	bool bInstanceTopology = true;
+
 	/** TBD */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding")
 	FPCGExAttributeToTagDetails TargetsAttributesToPathTags;
@@ -111,7 +111,8 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExCutEdgesContext final : FPCGExEdgesProce
 	TArray<TObjectPtr<const UPCGExFilterFactoryData>> NodeFilterFactories;
 
 	TArray<TSharedRef<PCGExData::FFacade>> PathFacades;
-	TArray<TSharedRef<PCGExPaths::FPath>> Paths;
+	TArray<TSharedPtr<PCGExPaths::FPath>> Paths;
+	TSharedPtr<PCGExPaths::FPathEdgeBVH> EdgeBVH;
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExCutEdgesElement final : public FPCGExEdgesProcessorElement
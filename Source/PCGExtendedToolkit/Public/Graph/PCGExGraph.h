@@ -152,6 +152,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExGraphBuilderDetails
 	bool WantsClusters() const;
 
 	bool IsValid(const TSharedPtr<PCGExGraph::FSubGraph>& InSubgraph) const;
+	bool IsValid(const int32 NumVtx, const int32 NumEdges) const;
 };
 
 namespace PCGExGraph
@@ -206,9 +207,101 @@ namespace PCGExGraph
 
 #pragma region Graph Utils
 
+	/**
+	 * Flat vtx key -> point index lookup, built in parallel.
+	 * Entries are packed as (Key << 32 | PointIndex), scattered into hashed buckets and sorted per bucket,
+	 * so a lookup is a hash followed by a short binary search.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEndpointsLookup
+	{
+		TArray<uint64> Entries;
+		TArray<int32> BucketOffsets; // NumBuckets + 1
+		uint32 BucketShift = 32;
+
+		FORCEINLINE int32 GetBucket(const uint32 Key) const { return static_cast<int32>(static_cast<uint64>(Key * 0x9E3779B9u) >> BucketShift); }
+
+	public:
+		FEndpointsLookup() = default;
+
+		/** Build from packed vtx indices (H64(Key, Adjacency)), optionally extracting the expected adjacency. */
+		void Build(const TArray<int64>& InPackedVtxIndices, TArray<int32>* OutAdjacency = nullptr);
+		void Empty();
+
+		FORCEINLINE int32 Num() const { return Entries.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Entries.IsEmpty(); }
+
+		/** @return the point index associated with Key, or -1 */
+		FORCEINLINE int32 Find(const uint32 Key) const
+		{
+			if (Entries.IsEmpty()) { return -1; }
+
+			const int32 Bucket = GetBucket(Key);
+			int32 Lo = BucketOffsets[Bucket];
+			int32 Hi = BucketOffsets[Bucket + 1];
+
+			const uint64* Data = Entries.GetData();
+			while (Lo < Hi)
+			{
+				const int32 Mid = (Lo + Hi) >> 1;
+				if (PCGEx::H64A(Data[Mid]) < Key) { Lo = Mid + 1; }
+				else { Hi = Mid; }
+			}
+
+			if (Lo < BucketOffsets[Bucket + 1] && PCGEx::H64A(Data[Lo]) == Key) { return static_cast<int32>(PCGEx::H64B(Data[Lo])); }
+			return -1;
+		}
+	};
+
+	/**
+	 * Open-addressed edge hash -> edge index map, with linear probing.
+	 * Edge hashes (H64U) are never 0 since endpoints differ, so 0 marks an empty slot.
+	 * Lookups are lock-free as long as nothing grows the map ; Add_Concurrent requires capacity to be reserved beforehand.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FEdgeHashMap
+	{
+		TArray<uint64> Keys;
+		TArray<int32> Values;
+		uint64 Mask = 0;
+		int32 NumItems = 0;
+
+		FORCEINLINE uint64 GetSlot(const uint64 Key) const { return (Key * 0x9E3779B97F4A7C15ull >> 32) & Mask; }
+
+	public:
+		FEdgeHashMap() = default;
+
+		FORCEINLINE int32 Num() const { return NumItems; }
+		FORCEINLINE bool IsEmpty() const { return NumItems == 0; }
+
+		/** Make sure InNum items can be added without exceeding half the capacity. Rehashing is serial. */
+		void Reserve(const int32 InNum);
+		void Empty();
+
+		/** @return the edge index associated with Key, or -1 */
+		FORCEINLINE int32 Find(const uint64 Key) const
+		{
+			if (Keys.IsEmpty()) { return -1; }
+
+			const uint64* Data = Keys.GetData();
+			for (uint64 Slot = GetSlot(Key);; Slot = (Slot + 1) & Mask)
+			{
+				const uint64 Other = Data[Slot];
+				if (Other == Key) { return Values[Slot]; }
+				if (Other == 0) { return -1; }
+			}
+		}
+
+		FORCEINLINE bool Contains(const uint64 Key) const { return Find(Key) != -1; }
+
+		/** Single-threaded add. @return false if the key already exists */
+		bool Add(const uint64 Key, const int32 Value);
+
+		/** Add a key known to be absent, from any thread. Capacity must have been reserved. */
+		void Add_Concurrent(const uint64 Key, const int32 Value);
+	};
+
 	static bool BuildIndexedEdges(
 		const TSharedPtr<PCGExData::FPointIO>& EdgeIO,
-		const TMap<uint32, int32>& EndpointsLookup,
+		const FEndpointsLookup& EndpointsLookup,
 		TArray<FEdge>& OutEdges,
 		const bool bStopOnError = false)
 	{
@@ -235,12 +328,12 @@ namespace PCGExGraph
 				uint32 B;
 				PCGEx::H64(Endpoints[i], A, B);
 
-				const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-				const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+				const int32 StartPointIndex = EndpointsLookup.Find(A);
+				const int32 EndPointIndex = EndpointsLookup.Find(B);
 
-				if ((!StartPointIndexPtr || !EndPointIndexPtr)) { continue; }
+				if (StartPointIndex == -1 || EndPointIndex == -1) { continue; }
 
-				OutEdges[EdgeIndex] = FEdge(EdgeIndex, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+				OutEdges[EdgeIndex] = FEdge(EdgeIndex, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 				EdgeIndex++;
 			}
 
@@ -254,16 +347,16 @@ namespace PCGExGraph
 				uint32 B;
 				PCGEx::H64(Endpoints[i], A, B);
 
-				const int32* StartPointIndexPtr = EndpointsLookup.Find(A);
-				const int32* EndPointIndexPtr = EndpointsLookup.Find(B);
+				const int32 StartPointIndex = EndpointsLookup.Find(A);
+				const int32 EndPointIndex = EndpointsLookup.Find(B);
 
-				if ((!StartPointIndexPtr || !EndPointIndexPtr))
+				if (StartPointIndex == -1 || EndPointIndex == -1)
 				{
 					bValid = false;
 					break;
 				}
 
-				OutEdges[i] = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+				OutEdges[i] = FEdge(i, StartPointIndex, EndPointIndex, i, EdgeIOIndex);
 			}
 		}
 
@@ -504,7 +597,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
 		TMap<int32, FGraphEdgeMetadata> EdgeMetadata;
 
-		TMap<uint64, int32> UniqueEdges;
+		FEdgeHashMap UniqueEdges;
 
 		TArray<TSharedRef<FSubGraph>> SubGraphs;
 		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup;
@@ -542,11 +635,28 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FEdge>& InEdges);
 
+		/**
+		 * Bulk insert edge hashes, along with the union size of each entry.
+		 * Union sizes are written to the metadata of newly created edges, from the first occurrence of their hash.
+		 * @return the index of the first inserted edge
+		 */
+		int32 InsertEdges(const TArray<uint64>& InEdges, const TArray<int32>& InUnionSizes, int32 InIOIndex);
+
+		/**
+		 * Insert batches of edge hashes in bulk, deduplicated against the graph and across batches.
+		 * Large inputs are processed in parallel : concurrent dedup, reserved edge indices, then a count/scatter link fill.
+		 * Results are identical to inserting each hash in order. Meant for producers that collect edges per scope.
+		 * The locked variant holds the graph lock for the whole insertion ; have a single owner insert rather than concurrent processors.
+		 * @return the index of the first inserted edge
+		 */
+		int32 InsertEdges_Unsafe(const TArray<TConstArrayView<uint64>>& InEdgeBatches, int32 InIOIndex);
+		int32 InsertEdges(const TArray<TConstArrayView<uint64>>& InEdgeBatches, int32 InIOIndex);
+
 		FORCEINLINE FEdge* FindEdge_Unsafe(const uint64 Hash)
 		{
-			const int32* Index = UniqueEdges.Find(Hash);
-			if (!Index) { return nullptr; }
-			return (Edges.GetData() + *Index);
+			const int32 Index = UniqueEdges.Find(Hash);
+			if (Index == -1) { return nullptr; }
+			return (Edges.GetData() + Index);
 		}
 
 		FORCEINLINE FEdge* FindEdge_Unsafe(const int32 A, const int32 B) { return FindEdge(PCGEx::H64U(A, B)); }
@@ -554,9 +664,9 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		FORCEINLINE FEdge* FindEdge(const uint64 Hash)
 		{
 			FReadScopeLock ReadScopeLock(GraphLock);
-			const int32* Index = UniqueEdges.Find(Hash);
-			if (!Index) { return nullptr; }
-			return (Edges.GetData() + *Index);
+			const int32 Index = UniqueEdges.Find(Hash);
+			if (Index == -1) { return nullptr; }
+			return (Edges.GetData() + Index);
 		}
 
 		FORCEINLINE FEdge* FindEdge(const int32 A, const int32 B) { return FindEdge(PCGEx::H64U(A, B)); }
@@ -764,7 +874,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 
 	static bool BuildEndpointsLookup(
 		const TSharedPtr<PCGExData::FPointIO>& InPointIO,
-		TMap<uint32, int32>& OutIndices,
+		FEndpointsLookup& OutIndices,
 		TArray<int32>& OutAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable);
@@ -775,18 +885,7 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 		const TUniquePtr<PCGExData::TBuffer<int64>> IndexBuffer = MakeUnique<PCGExData::TBuffer<int64>>(InPointIO.ToSharedRef(), Attr_PCGExVtxIdx);
 		if (!IndexBuffer->PrepareRead()) { return false; }
 
-		const TArray<int64>& Indices = *IndexBuffer->GetInValues().Get();
-
-		OutIndices.Reserve(Indices.Num());
-		for (int i = 0; i < Indices.Num(); i++)
-		{
-			uint32 A;
-			uint32 B;
-			PCGEx::H64(Indices[i], A, B);
-
-			OutIndices.Add(A, i);
-			OutAdjacency[i] = B;
-		}
+		OutIndices.Build(*IndexBuffer->GetInValues().Get(), &OutAdjacency);
 
 		return true;
 	}
@@ -61,7 +61,18 @@ namespace PCGExSanitizeClusters
 {
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExSanitizeClustersContext, UPCGExSanitizeClustersSettings>
 	{
+		friend class FBatch;
+
+	protected:
+		TArray<PCGExGraph::FEdge> IndexedEdges;
+		bool bIsClean = false;
+
 	public:
+		// Shared with the batch, see FBatch
+		TSharedPtr<TArray<int32>> VtxOwners;
+		TSharedPtr<TArray<int32>> VtxDegrees;
+		TSharedPtr<TArray<int32>> VtxLabels;
+
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
 		{
@@ -71,16 +82,30 @@ namespace PCGExSanitizeClusters
 		virtual ~FProcessor() override;
 
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+
+	protected:
+		bool CheckIsClean();
+		void ForwardEdges(const FPCGExGraphBuilderDetails& InDetails) const;
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatchWithGraphBuilder<FProcessor>
 	{
+		// Per-vtx bookkeeping for the clean check : owning edge set, edge count & union-find label.
+		TSharedPtr<TArray<int32>> VtxOwners;
+		TSharedPtr<TArray<int32>> VtxDegrees;
+		TSharedPtr<TArray<int32>> VtxLabels;
+
+		bool bForwardClean = false;
+
 	public:
 		FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges):
 			TBatchWithGraphBuilder(InContext, InVtx, InEdges)
 		{
+			bUsePersistentClusterCache = false;
 		}
 
+		virtual void Process() override;
+		virtual bool PrepareSingle(const TSharedPtr<FProcessor>& ClusterProcessor) override;
 		virtual void CompleteWork() override;
 		virtual void Output() override;
 	};
@@ -93,6 +93,11 @@ namespace PCGExSimplifyClusters
 		TSharedPtr<TArray<int8>> Breakpoints;
 		TSharedPtr<PCGExCluster::FNodeChainBuilder> ChainBuilder;
 
+		bool bComputeMeta = false;
+		TArray<int32> EdgeOffsets; // First simplified edge of each chain
+		TArray<uint64> EdgeHashes;
+		TArray<int32> EdgeUnionSizes;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade):
 			TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -105,6 +110,11 @@ namespace PCGExSimplifyClusters
 		virtual void CompleteWork() override;
 
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
+
+	protected:
+		template <typename FEmitFunc>
+		void ForEachSimplifiedEdge(const PCGExCluster::FNodeChain& Chain, FEmitFunc&& Emit) const;
+		void InsertSimplifiedEdges();
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
@@ -114,6 +124,7 @@ namespace PCGExSimplifyClusters
 	protected:
 		PCGExGraph::FGraphMetadataDetails GraphMetadataDetails;
 		TSharedPtr<TArray<int8>> Breakpoints;
+		TSharedPtr<PCGExPointFilter::FManager> BreakpointFilterManager;
 
 	public:
 		FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges):
@@ -127,5 +138,7 @@ namespace PCGExSimplifyClusters
 		virtual void RegisterBuffersDependencies(PCGExData::FFacadePreloader& FacadePreloader) override;
 		virtual void Process() override;
 		virtual bool PrepareSingle(const TSharedPtr<FProcessor>& ClusterProcessor) override;
+		virtual void CompileGraphBuilder(const bool bOutputToContext) override;
+		void OnBreakpointsComplete();
 	};
 }
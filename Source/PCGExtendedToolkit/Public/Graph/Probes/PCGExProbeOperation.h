@@ -59,6 +59,9 @@ public:
 	virtual bool PrepareForPoints(const TSharedPtr<PCGExData::FPointIO>& InPointIO);
 	virtual bool RequiresOctree();
 	virtual bool RequiresChainProcessing();
+
+	/** How many of the closest candidates must be sorted by distance before ProcessCandidates. -1 means all of them, 0 means order doesn't matter. */
+	virtual int32 GetRequiredSortedCandidates(const bool bWithCoincidence) const;
 	virtual void ProcessCandidates(const int32 Index, const FPCGPoint& Point, TArray<PCGExProbing::FCandidate>& Candidates, TSet<FInt32Vector>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges);
 
 	virtual void PrepareBestCandidate(const int32 Index, const FPCGPoint& Point, PCGExProbing::FBestCandidate& InBestCandidate);
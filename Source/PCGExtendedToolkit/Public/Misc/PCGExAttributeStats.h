@@ -134,6 +134,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Unique Set Values Num", EditCondition="bOutputUniqueSetValuesNum"))
 	FName UniqueSetValuesNumAttributeName = FName(TEXT("UniqueSetValues"));
 
+	/** */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputDistinctValuesNum = false;
+
+	/** Number of different values, regardless of how many times they appear. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Distinct Values Num", EditCondition="bOutputDistinctValuesNum"))
+	FName DistinctValuesNumAttributeName = FName(TEXT("DistinctValues"));
+
+	/** If enabled, Distinct Values Num is estimated using a HyperLogLog sketch (~1.6% error) instead of being counted exactly. Memory usage stays bounded regardless of the number of points. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, EditCondition="bOutputDistinctValuesNum"))
+	bool bApproximateDistinctValuesNum = false;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputDefaultValuesNum = true;
@@ -234,6 +246,56 @@ namespace PCGExAttributeStats
 	const FName OutputAttributeStats = FName("Stats");
 	const FName OutputAttributeUniqueValues = FName("UniqueValues");
 
+	// Points are processed in scopes of this size, each with its own accumulator
+	constexpr int32 StatsScopeSize = 32768;
+
+	/**
+	 * HyperLogLog distinct count estimator, 2^12 registers for a ~1.6% standard error.
+	 * Sketches are mergeable, so each scope can fill its own and combine them at the end.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FHyperLogLog
+	{
+		static constexpr int32 Precision = 12;
+		static constexpr int32 NumRegisters = 1 << Precision;
+
+		TArray<uint8> Registers;
+
+		FHyperLogLog() { Registers.Init(0, NumRegisters); }
+
+		FORCEINLINE void Add(const uint32 InHash)
+		{
+			const uint64 Hash = PCGEx::H64(InHash, HashCombineFast(InHash, 0x9E3779B9)) * 0x9E3779B97F4A7C15ull;
+			const int32 Register = static_cast<int32>(Hash >> (64 - Precision));
+			const uint8 Rank = static_cast<uint8>(FMath::CountLeadingZeros64((Hash << Precision) | (1ull << (Precision - 1))) + 1);
+			if (Rank > Registers[Register]) { Registers[Register] = Rank; }
+		}
+
+		FORCEINLINE void Merge(const FHyperLogLog& Other)
+		{
+			for (int i = 0; i < NumRegisters; i++) { Registers[i] = FMath::Max(Registers[i], Other.Registers[i]); }
+		}
+
+		int32 Estimate() const
+		{
+			double Sum = 0;
+			int32 NumZeros = 0;
+			for (const uint8 Rank : Registers)
+			{
+				Sum += FMath::Pow(2.0, -static_cast<double>(Rank));
+				if (Rank == 0) { NumZeros++; }
+			}
+
+			constexpr double M = NumRegisters;
+			const double Alpha = 0.7213 / (1.0 + 1.079 / M);
+			double Count = Alpha * M * M / Sum;
+
+			// Small range correction, linear counting
+			if (Count <= 2.5 * M && NumZeros > 0) { Count = M * FMath::Loge(M / static_cast<double>(NumZeros)); }
+
+			return FMath::RoundToInt32(Count);
+		}
+	};
+
 	class FAttributeStatsBase : public TSharedFromThis<FAttributeStatsBase>
 	{
 	public:
@@ -326,74 +388,120 @@ namespace PCGExAttributeStats
 				}
 
 				const int32 NumPoints = InDataFacade->GetNum();
-				TMap<T, int32> ValuesCount;
-				TMap<T, int32> SetValuesCount;
-				ValuesCount.Reserve(NumPoints);
-				SetValuesCount.Reserve(NumPoints);
-
 				DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
-				int32 NumValues = 0;
 
-				/*
-				auto ProcessBasics = [&](const T& InValue)
+				// Values only need to be counted if an output depends on it
+				const bool bApproximateDistinct = Settings->bOutputDistinctValuesNum && Settings->bApproximateDistinctValuesNum;
+				const bool bCountValues =
+					UniqueValuesParamData ||
+					Settings->bOutputUniqueValuesNum ||
+					Settings->bOutputUniqueSetValuesNum ||
+					Settings->bOutputHasOnlyUniqueValues ||
+					(Settings->bOutputDistinctValuesNum && !bApproximateDistinct);
+
+				struct FAccumulator
 				{
-					MinValue = PCGExMath::Min(MinValue, InValue);
-					MaxValue = PCGExMath::Max(MaxValue, InValue);
-					AverageValue = PCGExMath::Add(AverageValue, InValue);
+					T Min = T{};
+					T Max = T{};
+					T SetMin = T{};
+					T SetMax = T{};
+					T Sum = T{};
+					int32 NumValues = 0;
+					int32 NumDefaultValues = 0;
+					TMap<T, int32> ValuesCount;
+					TUniquePtr<FHyperLogLog> Distinct;
 				};
-				*/
 
-				for (int i = 0; i < NumPoints; i++)
-				{
-					if (!Filter[i]) { continue; }
-					NumValues++;
+				TArray<PCGExMT::FScope> Scopes;
+				const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, StatsScopeSize);
+
+				TArray<FAccumulator> Accumulators;
+				Accumulators.SetNum(NumScopes);
 
-					const T& Value = Buffer->Read(i);
+				PCGExMT::ParallelForBlocking(
+					NumScopes, [&](const int32 ScopeIndex)
+					{
+						const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+						FAccumulator& Acc = Accumulators[ScopeIndex];
 
-					MinValue = PCGExMath::Min(MinValue, Value);
-					MaxValue = PCGExMath::Max(MaxValue, Value);
-					AverageValue = PCGExMath::Add(AverageValue, Value);
+						PCGExMath::TypeMinMax(Acc.Min, Acc.Max);
+						PCGExMath::TypeMinMax(Acc.SetMin, Acc.SetMax);
+						if (bCountValues) { Acc.ValuesCount.Reserve(Scope.Count); }
+						if (bApproximateDistinct) { Acc.Distinct = MakeUnique<FHyperLogLog>(); }
 
-					const int32 Count = ValuesCount.FindOrAdd(Value, 0);
-					ValuesCount.Add(Value, Count + 1);
+						for (int i = Scope.Start; i < Scope.End; i++)
+						{
+							if (!Filter[i]) { continue; }
+							Acc.NumValues++;
+
+							const T& Value = Buffer->Read(i);
+
+							Acc.Min = PCGExMath::Min(Acc.Min, Value);
+							Acc.Max = PCGExMath::Max(Acc.Max, Value);
+							Acc.Sum = PCGExMath::Add(Acc.Sum, Value);
+
+							if (bCountValues) { Acc.ValuesCount.FindOrAdd(Value, 0)++; }
+							if (bApproximateDistinct) { Acc.Distinct->Add(GetTypeHash(Value)); }
+
+							if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+							{
+								Acc.NumDefaultValues++;
+							}
+							else
+							{
+								Acc.SetMin = PCGExMath::Min(Acc.SetMin, Value);
+								Acc.SetMax = PCGExMath::Max(Acc.SetMax, Value);
+							}
+						}
+					});
+
+				// Merge scopes in order, so the result doesn't depend on scheduling
+
+				int32 NumValues = 0;
+				TMap<T, int32> ValuesCount;
+				TUniquePtr<FHyperLogLog> Distinct;
 
-					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+				for (FAccumulator& Acc : Accumulators)
+				{
+					MinValue = PCGExMath::Min(MinValue, Acc.Min);
+					MaxValue = PCGExMath::Max(MaxValue, Acc.Max);
+					SetMinValue = PCGExMath::Min(SetMinValue, Acc.SetMin);
+					SetMaxValue = PCGExMath::Max(SetMaxValue, Acc.SetMax);
+					AverageValue = PCGExMath::Add(AverageValue, Acc.Sum);
+					NumValues += Acc.NumValues;
+					DefaultValuesNum += Acc.NumDefaultValues;
+
+					if (bCountValues)
 					{
-						DefaultValuesNum++;
+						if (ValuesCount.IsEmpty()) { ValuesCount = MoveTemp(Acc.ValuesCount); }
+						else { for (const TPair<T, int32>& Pair : Acc.ValuesCount) { ValuesCount.FindOrAdd(Pair.Key, 0) += Pair.Value; } }
 					}
-					else
-					{
-						const int32 SetCount = SetValuesCount.FindOrAdd(Value, 0);
-						SetValuesCount.Add(Value, SetCount + 1);
 
-						SetMinValue = PCGExMath::Min(SetMinValue, Value);
-						SetMaxValue = PCGExMath::Max(SetMaxValue, Value);
+					if (Acc.Distinct)
+					{
+						if (!Distinct) { Distinct = MoveTemp(Acc.Distinct); }
+						else { Distinct->Merge(*Acc.Distinct); }
 					}
 				}
 
+				Accumulators.Empty();
+
+				// Set values are all the counted values but the default one
+				auto IsSetValue = [&](const T& InValue) { return !PCGExCompare::StrictlyEqual(InValue, DefaultValue); };
+
 				if (UniqueValuesParamData)
 				{
 					UPCGMetadata* UVM = UniqueValuesParamData->Metadata;
 					FPCGMetadataAttribute<T>* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, MinValue);
 					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
 
-					if (Settings->bOmitDefaultValue)
-					{
-						for (const TPair<T, int32>& Pair : SetValuesCount)
-						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
-						}
-					}
-					else
+					for (const TPair<T, int32>& Pair : ValuesCount)
 					{
-						for (const TPair<T, int32>& Pair : ValuesCount)
-						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
-						}
+						if (Settings->bOmitDefaultValue && !IsSetValue(Pair.Key)) { continue; }
+
+						int64 UVKey = UVM->AddEntry();
+						UValues->SetValue(UVKey, Pair.Key);
+						UCount->SetValue(UVKey, Pair.Value);
 					}
 				}
 
@@ -403,15 +511,16 @@ namespace PCGExAttributeStats
 					for (const TPair<T, int32>& Pair : ValuesCount) { if (Pair.Value == 1) { UniqueValuesNum++; } }
 				}
 
-				if (Settings->bOutputUniqueSetValuesNum)
+				if (Settings->bOutputUniqueSetValuesNum || Settings->bOutputHasOnlyUniqueValues)
 				{
 					UniqueSetValuesNum = 0;
-					for (const TPair<T, int32>& Pair : SetValuesCount) { if (Pair.Value == 1) { UniqueSetValuesNum++; } }
+					for (const TPair<T, int32>& Pair : ValuesCount) { if (Pair.Value == 1 && IsSetValue(Pair.Key)) { UniqueSetValuesNum++; } }
 				}
 
+				const int32 DistinctValuesNum = Distinct ? Distinct->Estimate() : ValuesCount.Num();
 
 				ValuesCount.Empty();
-				SetValuesCount.Empty();
+				Distinct.Reset();
 
 				////// OUTPUT
 
@@ -423,6 +532,7 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(AverageValue, T, PCGExMath::Div(AverageValue, static_cast<double>(NumValues)))
 				PCGEX_OUTPUT_STAT(UniqueValuesNum, int32, UniqueValuesNum)
 				PCGEX_OUTPUT_STAT(UniqueSetValuesNum, int32, UniqueSetValuesNum)
+				PCGEX_OUTPUT_STAT(DistinctValuesNum, int32, DistinctValuesNum)
 				PCGEX_OUTPUT_STAT(DefaultValuesNum, int32, DefaultValuesNum)
 				PCGEX_OUTPUT_STAT(HasOnlyDefaultValues, bool, NumValues == DefaultValuesNum)
 				PCGEX_OUTPUT_STAT(HasOnlySetValues, bool, DefaultValuesNum == 0)
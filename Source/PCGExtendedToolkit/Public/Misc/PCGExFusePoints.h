@@ -111,6 +111,14 @@ namespace PCGExFusePoints
 		TSharedPtr<PCGExGraph::FUnionGraph> UnionGraph;
 		TSharedPtr<PCGExDataBlending::FUnionBlender> UnionBlender;
 
+		// Voxel fuse only works on points and doesn't need the graph ; points are grouped by sorting their grid keys.
+		bool bFuseByVoxel = false;
+		FPCGExFuseDetails FuseDetails;
+		TArray<uint32> GridKeys;
+		TArray<int32> FusedIndices;            // Input point indices, grouped by voxel
+		TArray<PCGExMT::FScope> FusedScopes;   // Per output point, its range within FusedIndices
+		TSharedPtr<PCGExData::FUnionMetadata> PointsUnion;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 			: TPointsProcessor(InPointDataFacade)
@@ -125,5 +133,8 @@ namespace PCGExFusePoints
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 		virtual void Write() override;
+
+	protected:
+		void BuildVoxelUnion();
 	};
 }
@@ -12,41 +12,13 @@
 
 namespace PCGExPartition
 {
-	class FKPartition;
-
-	class /*PCGEXTENDEDTOOLKIT_API*/ FKPartition : public TSharedFromThis<FKPartition>
+	/** A partition is a contiguous range of the sorted point indices, sharing the same key for every rule. */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FKPartition
 	{
-	protected:
-		mutable FRWLock LayersLock;
-		mutable FRWLock PointLock;
-
-	public:
-		FKPartition(const TWeakPtr<FKPartition>& InParent, int64 InKey, FRule* InRule, int32 InPartitionIndex);
-		~FKPartition();
-
-		TWeakPtr<FKPartition> Parent;
 		int32 IOIndex = -1;
-		int32 PartitionIndex = 0;
-		int64 PartitionKey = 0;
-		FRule* Rule = nullptr;
-
-		TSet<int64> UniquePartitionKeys;
-		TMap<int64, TSharedPtr<FKPartition>> SubLayers;
-		TArray<int32> Points;
-
-		int32 GetNum() const { return Points.Num(); }
-		int32 GetSubPartitionsNum();
-
-		TSharedPtr<FKPartition> GetPartition(int64 Key, FRule* InRule);
-		FORCEINLINE void Add(const int64 Index)
-		{
-			FWriteScopeLock WriteLock(PointLock);
-			Points.Add(Index);
-		}
-
-		void Register(TArray<TSharedPtr<FKPartition>>& Partitions);
-
-		void SortPartitions();
+		int32 Order = 0; // Position in the lexicographic order of rule keys
+		int32 Start = 0;
+		int32 Count = 0;
 	};
 }
 
@@ -147,10 +119,10 @@ namespace PCGExPartitionByValues
 		TArray<PCGExPartition::FRule> Rules;
 		TArray<int64> KeySums;
 
-		TSharedPtr<PCGExPartition::FKPartition> RootPartition;
-
 		int32 NumPartitions = -1;
-		TArray<TSharedPtr<PCGExPartition::FKPartition>> Partitions;
+		TArray<PCGExPartition::FKPartition> Partitions;
+		TArray<int32> SortedIndices;
+		TArray<int64> PartitionIndices;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
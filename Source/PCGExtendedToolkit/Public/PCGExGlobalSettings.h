@@ -20,6 +20,13 @@ enum class EPCGExAsyncPriority : uint8
 	BackgroundLow    = 5 UMETA(DisplayName = "BackgroundLow", ToolTip="..."),
 };
 
+UENUM()
+enum class EPCGExVtxSpatialOrder : uint8
+{
+	Lexicographic = 0 UMETA(DisplayName = "XYZ", ToolTip="Sort vtx along X, then Y, then Z."),
+	Morton        = 1 UMETA(DisplayName = "Morton", ToolTip="Sort vtx along a Z-order curve. Neighboring vtx end up closer in memory, which helps downstream cluster processing."),
+};
+
 UENUM()
 enum class EPCGExDataBlendingTypeDefault : uint8
 {
@@ -94,6 +101,20 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Keep built clusters in a process-wide cache keyed by the content of their vtx/edges data, so unchanged clusters are reused across executions and components. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
+	bool bPersistentClusterCache = false;
+
+	/** Approximate amount of memory (in MB) the persistent cluster cache may use before evicting least recently used clusters. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters && bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheBudget = 256;
+	int64 GetPersistentClusterCacheBudget() const { return static_cast<int64>(PersistentClusterCacheBudget) * 1024 * 1024; }
+	bool UsePersistentClusterCache() const { return bCacheClusters && bPersistentClusterCache; }
+
+	/** Spatial order in which vtx are written when compiling a graph. Both are deterministic, positions are quantized so sorting can use a parallel radix sort. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	EPCGExVtxSpatialOrder VtxSpatialOrder = EPCGExVtxSpatialOrder::Lexicographic;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 256;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -102,6 +123,15 @@ public:
 	int32 PointsDefaultBatchChunkSize = 256;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Move least recently used shared point data to a local disk cache once the memory budget is exceeded. Spilled data is reloaded transparently when requested again. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Data Sharing")
+	bool bSharedDataSpillToDisk = false;
+
+	/** Approximate amount of memory (in MB) shared data buckets may keep resident before spilling to disk. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Data Sharing", meta=(EditCondition="bSharedDataSpillToDisk", ClampMin=1))
+	int32 SharedDataMemoryBudget = 1024;
+	int64 GetSharedDataMemoryBudget() const { return static_cast<int64>(SharedDataMemoryBudget) * 1024 * 1024; }
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::BackgroundNormal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::BackgroundNormal : DefaultWorkPriority; }
@@ -12,6 +12,8 @@
 #include "Templates/SharedPointer.h"
 #include "Templates/SharedPointerFwd.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
 #include "Misc/QueuedThreadPool.h"
 
 #include "PCGExMacros.h"
@@ -208,6 +210,264 @@ namespace PCGExMT
 		}
 	};
 
+#pragma region Blocking Parallel Passes
+
+	/**
+	 * Run Body(Index) for every index in [0, Num), and only return once all of them are done.
+	 * This is the single entry point for blocking data-parallel passes ; don't call the engine's ParallelFor directly.
+	 *
+	 * Contract :
+	 * - The calling worker waits for the whole pass. Only use it for short bulk passes (counts, prefix sums, scatters)
+	 *   nested in a task that already holds its work permit. Long or cancellable work goes through FTaskGroup::StartSubLoops.
+	 * - Don't run a pass while holding a lock other tasks are contending on, they would stall for its whole duration.
+	 *   Gather first, then have a single owner do the locked part.
+	 * - Body must be thread-safe, and must neither launch nor wait on task groups.
+	 * - Iterations are scheduled at background priority so nested passes don't compete with foreground work.
+	 */
+	template <typename FBodyFunc>
+	static void ParallelForBlocking(const int32 Num, FBodyFunc&& Body, const bool bForceSingleThread = false)
+	{
+		if (Num <= 0) { return; }
+
+		if (Num == 1 || bForceSingleThread)
+		{
+			for (int32 i = 0; i < Num; i++) { Body(i); }
+			return;
+		}
+
+		::ParallelFor(Num, Body, EParallelForFlags::BackgroundPriority);
+	}
+
+#pragma endregion
+
+#pragma region Compaction
+
+	// Below this many items, compaction runs inline ; the parallel passes are not worth their overhead.
+	constexpr int32 CompactionScopeSize = 4096;
+
+	/**
+	 * Gather the indices of items that pass CanKeep, in their original order.
+	 * Runs as count per scope -> exclusive prefix sum -> parallel scatter, CanKeep is evaluated twice per item and must be thread-safe.
+	 * @return the number of kept items
+	 */
+	template <typename FKeepFunc>
+	static int32 GetCompactionIndices(TArray<int32>& OutReadIndices, const int32 NumItems, FKeepFunc&& CanKeep)
+	{
+		OutReadIndices.Reset();
+		if (NumItems <= 0) { return 0; }
+
+		if (NumItems <= CompactionScopeSize)
+		{
+			OutReadIndices.Reserve(NumItems);
+			for (int32 i = 0; i < NumItems; i++) { if (CanKeep(i)) { OutReadIndices.Add(i); } }
+			return OutReadIndices.Num();
+		}
+
+		TArray<FScope> Scopes;
+		const int32 NumScopes = SubLoopScopes(Scopes, NumItems, CompactionScopeSize);
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumScopes);
+
+		ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const FScope& Scope = Scopes[ScopeIndex];
+				int32 Count = 0;
+				for (int32 i = Scope.Start; i < Scope.End; i++) { if (CanKeep(i)) { Count++; } }
+				Offsets[ScopeIndex] = Count;
+			});
+
+		int32 NumKept = 0;
+		for (int32& Offset : Offsets)
+		{
+			const int32 Count = Offset;
+			Offset = NumKept;
+			NumKept += Count;
+		}
+
+		if (NumKept == 0) { return 0; }
+
+		OutReadIndices.SetNumUninitialized(NumKept);
+
+		ParallelForBlocking(
+			NumScopes, [&](const int32 ScopeIndex)
+			{
+				const FScope& Scope = Scopes[ScopeIndex];
+				int32 WriteIndex = Offsets[ScopeIndex];
+				for (int32 i = Scope.Start; i < Scope.End; i++) { if (CanKeep(i)) { OutReadIndices[WriteIndex++] = i; } }
+			});
+
+		return NumKept;
+	}
+
+	/**
+	 * Compact an array using indices produced by GetCompactionIndices.
+	 * Large arrays are gathered in parallel into a fresh allocation, which means any view into InOutArray is invalidated.
+	 */
+	template <typename T>
+	static void Gather(TArray<T>& InOutArray, const TArray<int32>& InReadIndices)
+	{
+		const int32 NumKept = InReadIndices.Num();
+		if (NumKept == InOutArray.Num()) { return; } // Nothing was removed
+
+		if (NumKept <= CompactionScopeSize)
+		{
+			// Read indices are sorted & always >= their write index, so this is safe in-place
+			for (int32 i = 0; i < NumKept; i++) { if (InReadIndices[i] != i) { InOutArray[i] = MoveTemp(InOutArray[InReadIndices[i]]); } }
+			InOutArray.SetNum(NumKept);
+			return;
+		}
+
+		TArray<T> Compacted;
+		Compacted.SetNumUninitialized(NumKept);
+
+		ParallelForBlocking(
+			FMath::DivideAndRoundUp(NumKept, CompactionScopeSize), [&](const int32 ScopeIndex)
+			{
+				const int32 Start = ScopeIndex * CompactionScopeSize;
+				const int32 End = FMath::Min(Start + CompactionScopeSize, NumKept);
+				T* Data = Compacted.GetData();
+				for (int32 i = Start; i < End; i++) { new(Data + i) T(MoveTemp(InOutArray[InReadIndices[i]])); }
+			});
+
+		InOutArray = MoveTemp(Compacted);
+	}
+
+	/**
+	 * Remove every item that doesn't pass CanKeep(Index), preserving order.
+	 * @return the number of kept items
+	 */
+	template <typename T, typename FKeepFunc>
+	static int32 Compact(TArray<T>& InOutArray, FKeepFunc&& CanKeep)
+	{
+		TArray<int32> ReadIndices;
+		const int32 NumKept = GetCompactionIndices(ReadIndices, InOutArray.Num(), CanKeep);
+		Gather(InOutArray, ReadIndices);
+		return NumKept;
+	}
+
+#pragma endregion
+
+#pragma region Radix Sort
+
+	/**
+	 * Sort values by their uint64 key, in parallel.
+	 * LSD radix sort over 8-bit digits : per-scope histograms -> digit-major prefix sum -> stable scatter.
+	 * Digits that are identical across all keys are skipped, so keys that only use their low bits are cheap.
+	 * The sort is stable, equal keys keep their relative order and the result doesn't depend on scheduling.
+	 */
+	static void RadixSort(TArray<uint64>& InOutKeys, TArray<int32>& InOutValues)
+	{
+		check(InOutKeys.Num() == InOutValues.Num())
+
+		const int32 NumItems = InOutKeys.Num();
+		if (NumItems <= 1) { return; }
+
+		if (NumItems <= CompactionScopeSize)
+		{
+			TArray<TPair<uint64, int32>> Pairs;
+			Pairs.SetNumUninitialized(NumItems);
+			for (int32 i = 0; i < NumItems; i++) { Pairs[i] = TPair<uint64, int32>(InOutKeys[i], i); }
+
+			// Pairs compare by key then original position, which makes this equivalent to a stable sort
+			Algo::Sort(Pairs);
+
+			TArray<int32> SortedValues;
+			SortedValues.SetNumUninitialized(NumItems);
+			for (int32 i = 0; i < NumItems; i++)
+			{
+				InOutKeys[i] = Pairs[i].Key;
+				SortedValues[i] = InOutValues[Pairs[i].Value];
+			}
+
+			InOutValues = MoveTemp(SortedValues);
+			return;
+		}
+
+		constexpr int32 NumBuckets = 256;
+
+		TArray<FScope> Scopes;
+		const int32 NumScopes = SubLoopScopes(Scopes, NumItems, FMath::Max(CompactionScopeSize, FMath::DivideAndRoundUp(NumItems, 64)));
+
+		TArray<uint64> KeysBuffer;
+		TArray<int32> ValuesBuffer;
+		KeysBuffer.SetNumUninitialized(NumItems);
+		ValuesBuffer.SetNumUninitialized(NumItems);
+
+		TArray<uint64>* ReadKeys = &InOutKeys;
+		TArray<int32>* ReadValues = &InOutValues;
+		TArray<uint64>* WriteKeys = &KeysBuffer;
+		TArray<int32>* WriteValues = &ValuesBuffer;
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumScopes * NumBuckets);
+
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
+		{
+			FMemory::Memzero(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+
+			ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					const FScope& Scope = Scopes[ScopeIndex];
+					const uint64* Keys = ReadKeys->GetData();
+					int32* Counts = Offsets.GetData() + ScopeIndex * NumBuckets;
+					for (int32 i = Scope.Start; i < Scope.End; i++) { Counts[(Keys[i] >> Shift) & 0xFF]++; }
+				});
+
+			int32 Offset = 0;
+			bool bTrivialDigit = false;
+			for (int32 b = 0; b < NumBuckets; b++)
+			{
+				const int32 BucketStart = Offset;
+				for (int32 s = 0; s < NumScopes; s++)
+				{
+					int32& Count = Offsets[s * NumBuckets + b];
+					const int32 ScopeCount = Count;
+					Count = Offset;
+					Offset += ScopeCount;
+				}
+
+				if (Offset - BucketStart == NumItems)
+				{
+					bTrivialDigit = true;
+					break;
+				}
+			}
+
+			if (bTrivialDigit) { continue; }
+
+			ParallelForBlocking(
+				NumScopes, [&](const int32 ScopeIndex)
+				{
+					const FScope& Scope = Scopes[ScopeIndex];
+					const uint64* Keys = ReadKeys->GetData();
+					const int32* Values = ReadValues->GetData();
+					uint64* OutKeys = WriteKeys->GetData();
+					int32* OutValues = WriteValues->GetData();
+					int32* WriteIndices = Offsets.GetData() + ScopeIndex * NumBuckets;
+					for (int32 i = Scope.Start; i < Scope.End; i++)
+					{
+						const int32 WriteIndex = WriteIndices[(Keys[i] >> Shift) & 0xFF]++;
+						OutKeys[WriteIndex] = Keys[i];
+						OutValues[WriteIndex] = Values[i];
+					}
+				});
+
+			Swap(ReadKeys, WriteKeys);
+			Swap(ReadValues, WriteValues);
+		}
+
+		if (ReadKeys != &InOutKeys)
+		{
+			InOutKeys = MoveTemp(KeysBuffer);
+			InOutValues = MoveTemp(ValuesBuffer);
+		}
+	}
+
+#pragma endregion
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FAsyncHandle : public TSharedFromThis<FAsyncHandle>
 	{
 	protected:
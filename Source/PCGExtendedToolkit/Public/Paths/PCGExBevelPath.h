@@ -256,6 +256,7 @@ namespace PCGExBevelPath
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
 		void WriteFlags(const int32 Index);
+		virtual void OnRangeProcessingComplete() override;
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
@@ -123,6 +123,8 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathCrossingsContext final : FPCGExPathP
 
 	TSharedPtr<PCGExDetails::FDistances> Distances;
 	FPCGExBlendingDetails CrossingBlending;
+
+	TSharedPtr<PCGExPaths::FPathEdgeBVH> EdgeBVH; // Shared cutting edges, built once all paths are prepared
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathCrossingsElement final : public FPCGExPathProcessorElement
@@ -194,7 +196,7 @@ namespace PCGExPathCrossings
 
 		virtual bool IsTrivial() const override { return false; } // Force non-trivial because this shit is expensive
 
-		const PCGExPaths::FPathEdgeOctree* GetEdgeOctree() const { return Path->GetEdgeOctree(); }
+		void RegisterCuttingEdges(PCGExPaths::FPathEdgeBVH& InEdgeBVH) const;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const PCGExMT::FScope& Scope) override;
@@ -204,4 +206,15 @@ namespace PCGExPathCrossings
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection):
+			TBatch(InContext, InPointsCollection)
+		{
+		}
+
+		virtual void CompleteWork() override;
+	};
 }
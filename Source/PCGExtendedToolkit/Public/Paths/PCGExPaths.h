@@ -9,6 +9,7 @@
 #include "Data/PCGSplineStruct.h"
 #include "Graph/PCGExCluster.h"
 #include "Graph/PCGExEdge.h"
+#include "Geometry/PCGExGeoBVH.h"
 
 #include "PCGExPaths.generated.h"
 
@@ -817,6 +818,163 @@ namespace PCGExPaths
 		return StaticCastSharedPtr<FPath>(P);
 	}
 
+	/**
+	 * Immutable, shared segment BVH over the edges of many paths.
+	 * Register paths with AddPath, then call Build once; queries are thread-safe afterward.
+	 * Nodes are split using binned SAH, large subtrees are built in parallel.
+	 */
+	class FPathEdgeBVH : public TSharedFromThis<FPathEdgeBVH>
+	{
+	public:
+		struct FItem
+		{
+			int32 Path = -1;
+			int32 Edge = -1;
+		};
+
+	protected:
+		TArray<TSharedPtr<FPath>> Paths;
+		TArray<const TArray<int8>*> Filters;
+
+		TArray<FItem> Items;
+		TArray<FBox> ItemBounds;
+		TArray<PCGExGeo::FBVHNode> Nodes;
+
+	public:
+		FPathEdgeBVH() = default;
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+		FORCEINLINE const FPath* GetPath(const int32 Index) const { return Paths[Index].Get(); }
+
+		/**
+		 * Register a path. Optional filter must outlive Build, and is indexed by edge.
+		 * @return index of the path inside this BVH
+		 */
+		int32 AddPath(const TSharedPtr<FPath>& InPath, const TArray<int8>* InFilter = nullptr);
+
+		void Build();
+
+		/** Callback(const FPath* Path, const FPathEdge& Edge) */
+		template <typename FCallback>
+		void FindElementsWithBoundsTest(const FBox& InBox, FCallback&& Callback) const
+		{
+			FindFirstElementWithBoundsTest(
+				InBox, [&](const FPath* InPath, const FPathEdge& InEdge)
+				{
+					Callback(InPath, InEdge);
+					return true;
+				});
+		}
+
+		/** Callback(const FPath* Path, const FPathEdge& Edge) -> bool, return false to stop the query. */
+		template <typename FCallback>
+		bool FindFirstElementWithBoundsTest(const FBox& InBox, FCallback&& Callback) const
+		{
+			if (Items.IsEmpty() || !Nodes[0].Bounds.Intersect(InBox)) { return true; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				const PCGExGeo::FBVHNode& Node = Nodes[Stack.Pop(false)];
+#else
+				const PCGExGeo::FBVHNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+
+				if (Node.Count)
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						if (!ItemBounds[i].Intersect(InBox)) { continue; }
+						const FItem& Item = Items[i];
+						const FPath* ItemPath = Paths[Item.Path].Get();
+						if (!Callback(ItemPath, ItemPath->Edges[Item.Edge])) { return false; }
+					}
+					continue;
+				}
+
+				if (Nodes[Node.Start].Bounds.Intersect(InBox)) { Stack.Add(Node.Start); }
+				if (Nodes[Node.Start + 1].Bounds.Intersect(InBox)) { Stack.Add(Node.Start + 1); }
+			}
+
+			return true;
+		}
+
+		/**
+		 * Segment query; only visits edges whose bounds, expanded by Expansion, are crossed by the segment AB.
+		 * Callback(const FPath* Path, const FPathEdge& Edge) -> bool, return false to stop the query.
+		 */
+		template <typename FCallback>
+		bool FindFirstSegmentCandidate(const FVector& A, const FVector& B, const double Expansion, FCallback&& Callback) const
+		{
+			if (Items.IsEmpty()) { return true; }
+
+			FBox SegmentBox = FBox(ForceInit);
+			SegmentBox += A;
+			SegmentBox += B;
+			SegmentBox = SegmentBox.ExpandBy(Expansion);
+
+			const FVector Delta = B - A;
+			const FVector InvDelta = FVector(
+				Delta.X != 0 ? 1 / Delta.X : BIG_NUMBER,
+				Delta.Y != 0 ? 1 / Delta.Y : BIG_NUMBER,
+				Delta.Z != 0 ? 1 / Delta.Z : BIG_NUMBER);
+
+			auto Overlaps = [&](const FBox& InBounds)
+			{
+				if (!InBounds.Intersect(SegmentBox)) { return false; }
+				const FBox Expanded = InBounds.ExpandBy(Expansion);
+				return FMath::LineBoxIntersection(Expanded, A, B, Delta, InvDelta);
+			};
+
+			if (!Overlaps(Nodes[0].Bounds)) { return true; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if PCGEX_ENGINE_VERSION <= 503
+				const PCGExGeo::FBVHNode& Node = Nodes[Stack.Pop(false)];
+#else
+				const PCGExGeo::FBVHNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+#endif
+
+				if (Node.Count)
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						if (!Overlaps(ItemBounds[i])) { continue; }
+						const FItem& Item = Items[i];
+						const FPath* ItemPath = Paths[Item.Path].Get();
+						if (!Callback(ItemPath, ItemPath->Edges[Item.Edge])) { return false; }
+					}
+					continue;
+				}
+
+				if (Overlaps(Nodes[Node.Start].Bounds)) { Stack.Add(Node.Start); }
+				if (Overlaps(Nodes[Node.Start + 1].Bounds)) { Stack.Add(Node.Start + 1); }
+			}
+
+			return true;
+		}
+
+		/** Callback(const FPath* Path, const FPathEdge& Edge) */
+		template <typename FCallback>
+		void FindSegmentCandidates(const FVector& A, const FVector& B, const double Expansion, FCallback&& Callback) const
+		{
+			FindFirstSegmentCandidate(
+				A, B, Expansion, [&](const FPath* InPath, const FPathEdge& InEdge)
+				{
+					Callback(InPath, InEdge);
+					return true;
+				});
+		}
+	};
+
 	static FTransform GetClosestTransform(const FPCGSplineStruct& InSpline, const FVector& InLocation, const bool bUseScale = true)
 	{
 		return InSpline.GetTransformAtSplineInputKey(InSpline.FindInputKeyClosestToWorldLocation(InLocation), ESplineCoordinateSpace::World, bUseScale);
@@ -114,6 +114,11 @@ namespace PCGExSmooth
 		UPCGExSmoothingOperation* TypedOperation = nullptr;
 		bool bClosedLoop = false;
 
+		FPCGExPropertiesBlendingDetails PropertiesBlending;
+		TArray<double> SmoothingAmounts;
+		bool bSmoothPropertiesAtOnce = false;
+		bool bBlendAttributes = true;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -125,6 +130,7 @@ namespace PCGExSmooth
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 		virtual void CompleteWork() override;
 	};
 }
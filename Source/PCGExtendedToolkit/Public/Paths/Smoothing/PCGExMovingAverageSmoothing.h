@@ -9,6 +9,131 @@
 
 #include "PCGExMovingAverageSmoothing.generated.h"
 
+namespace PCGExMovingAverage
+{
+	constexpr int32 ChunkSize = 4096;
+
+	/**
+	 * Triangular-weighted moving average of a single channel.
+	 * The triangular kernel is two cascaded box filters, each evaluated with first-order prefix sums.
+	 * Points are processed in chunks of consecutive points sharing the same window; a chunk costs its length
+	 * plus its window width, and only sums over its own span so running totals stay small on long paths.
+	 * Closed loops read values periodically, so windows wider than the path wrap like the per-point path does.
+	 */
+	template <typename T, typename FGetFunc, typename FSetFunc>
+	static void SmoothChannel(
+		const EPCGExDataBlendingType Blending,
+		const TArray<int32>& Windows,
+		const bool bClosedLoop,
+		FGetFunc&& Get,
+		FSetFunc&& Set)
+	{
+		if (Blending == EPCGExDataBlendingType::None) { return; }
+
+		const int32 NumPoints = Windows.Num();
+		if (NumPoints == 0) { return; }
+
+		const bool bAverage = Blending == EPCGExDataBlendingType::Average;
+
+		T Zero;
+		if constexpr (std::is_same_v<T, double>) { Zero = 0; }
+		else { Zero = T::Zero(); }
+
+		// Values are centered on their mean to keep the sums well conditioned
+		T Ref = Zero;
+		for (int i = 0; i < NumPoints; i++) { Ref += Get(i); }
+		Ref = Ref * (1.0 / static_cast<double>(NumPoints));
+
+		// Split points into chunks of consecutive points sharing the same window
+		struct FChunk
+		{
+			int32 Start = 0;
+			int32 End = 0; // Inclusive
+		};
+
+		TArray<FChunk> Chunks;
+		for (int i = 0; i < NumPoints;)
+		{
+			const int32 W = Windows[i];
+			const int32 MaxLength = FMath::Max(ChunkSize, W);
+
+			int32 End = i;
+			while (End + 1 < NumPoints && Windows[End + 1] == W && End + 1 - i < MaxLength) { End++; }
+
+			if (W > 0) { Chunks.Add({i, End}); }
+			i = End + 1;
+		}
+
+		auto GetValue = [&](const int64 Index) -> T
+		{
+			if (bClosedLoop)
+			{
+				const int64 Wrapped = Index % NumPoints;
+				return Get(static_cast<int32>(Wrapped < 0 ? Wrapped + NumPoints : Wrapped)) - Ref;
+			}
+
+			if (Index < 0 || Index >= NumPoints) { return Zero; }
+			return Get(static_cast<int32>(Index)) - Ref;
+		};
+
+		PCGExMT::ParallelForBlocking(
+			Chunks.Num(), [&](const int32 ChunkIndex)
+			{
+				const FChunk& Chunk = Chunks[ChunkIndex];
+				const int32 W = Windows[Chunk.Start];
+
+				// Average is a single box over [i - W, i + W] ; Weight is the triangle (W - |j - i|) over ]i - W, i + W[
+				const int32 HalfSpan = bAverage ? W : W - 1;
+				const int64 Offset = static_cast<int64>(Chunk.Start) - HalfSpan;
+				const int32 SpanLength = Chunk.End - Chunk.Start + 1 + HalfSpan * 2;
+
+				// First box pass
+				TArray<T> P;
+				P.SetNumUninitialized(SpanLength + 1);
+				P[0] = Zero;
+				for (int u = 0; u < SpanLength; u++) { P[u + 1] = P[u] + GetValue(Offset + u); }
+
+				if (bAverage)
+				{
+					for (int i = Chunk.Start; i <= Chunk.End; i++)
+					{
+						// Local index of i - W is i - Chunk.Start
+						const int32 Local = i - Chunk.Start;
+						const int64 A = bClosedLoop ? i - W : FMath::Max(0, i - W);
+						const int64 B = bClosedLoop ? i + W : FMath::Min(NumPoints - 1, i + W);
+						Set(i, Ref + (P[Local + W * 2 + 1] - P[Local]) * (1.0 / static_cast<double>(B - A + 1)));
+					}
+					return;
+				}
+
+				// Second box pass over the W-wide sums of the first one
+				const int32 NumBoxes = SpanLength - W + 1;
+				TArray<T> C;
+				C.SetNumUninitialized(NumBoxes + 1);
+				C[0] = Zero;
+				for (int k = 0; k < NumBoxes; k++) { C[k + 1] = C[k] + (P[k + W] - P[k]); }
+
+				for (int i = Chunk.Start; i <= Chunk.End; i++)
+				{
+					// Boxes starting in [i - W + 1, i] ; local index of i - W + 1 is i - Chunk.Start
+					const int32 Local = i - Chunk.Start;
+					const T Sum = C[Local + W] - C[Local];
+
+					// Sum of the weights of the points actually covered ; W * W for a full window
+					double TotalWeight = static_cast<double>(W) * W;
+					if (!bClosedLoop)
+					{
+						const double NL = FMath::Min(i, W - 1) + 1;
+						const double NR = FMath::Min(NumPoints - 1 - i, W - 1);
+						TotalWeight = NL * W - NL * (NL - 1) * 0.5 + NR * W - NR * (NR + 1) * 0.5;
+					}
+
+					Set(i, Ref + Sum * (1.0 / TotalWeight));
+				}
+			});
+	}
+}
+
 /**
  * 
  */
@@ -65,4 +190,82 @@ public:
 
 		MetadataBlender->CompleteBlending(Target, Count, TotalWeight);
 	}
+
+	virtual bool CanSmoothProperties(const FPCGExPropertiesBlendingDetails& InBlending) const override
+	{
+		// Only linear blendings can be expressed as window sums
+#define PCGEX_CHECK_LINEAR_BLEND(_TYPE, _NAME, ...) \
+		if (InBlending._NAME##Blending != EPCGExDataBlendingType::None && \
+			InBlending._NAME##Blending != EPCGExDataBlendingType::Average && \
+			InBlending._NAME##Blending != EPCGExDataBlendingType::Weight) { return false; }
+		PCGEX_FOREACH_BLEND_POINTPROPERTY(PCGEX_CHECK_LINEAR_BLEND)
+#undef PCGEX_CHECK_LINEAR_BLEND
+
+		return true;
+	}
+
+	virtual void SmoothProperties(
+		const TSharedRef<PCGExData::FPointIO>& Path,
+		const FPCGExPropertiesBlendingDetails& InBlending,
+		const TArrayView<const double>& SmoothingAmounts,
+		const bool bClosedLoop) override
+	{
+		const TArray<FPCGPoint>& InPoints = Path->GetIn()->GetPoints();
+		TArray<FPCGPoint>& OutPoints = Path->GetOut()->GetMutablePoints();
+
+		// Same window resolution as SmoothSingle
+		TArray<int32> Windows;
+		Windows.SetNumUninitialized(InPoints.Num());
+		for (int i = 0; i < Windows.Num(); i++)
+		{
+			const int32 SmoothingInt = SmoothingAmounts[i];
+			Windows[i] = SmoothingInt == 0 ? 0 : FMath::Max(1, SmoothingInt);
+		}
+
+		PCGExMovingAverage::SmoothChannel<double>(
+			InBlending.DensityBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return static_cast<double>(InPoints[i].Density); },
+			[&](const int32 i, const double V) { OutPoints[i].Density = V; });
+
+		PCGExMovingAverage::SmoothChannel<FVector>(
+			InBlending.BoundsMinBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].BoundsMin; },
+			[&](const int32 i, const FVector& V) { OutPoints[i].BoundsMin = V; });
+
+		PCGExMovingAverage::SmoothChannel<FVector>(
+			InBlending.BoundsMaxBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].BoundsMax; },
+			[&](const int32 i, const FVector& V) { OutPoints[i].BoundsMax = V; });
+
+		PCGExMovingAverage::SmoothChannel<FVector4>(
+			InBlending.ColorBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].Color; },
+			[&](const int32 i, const FVector4& V) { OutPoints[i].Color = V; });
+
+		PCGExMovingAverage::SmoothChannel<FVector>(
+			InBlending.PositionBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].Transform.GetLocation(); },
+			[&](const int32 i, const FVector& V) { OutPoints[i].Transform.SetLocation(V); });
+
+		// Rotations are blended on their euler components, like PCGExMath::WeightedAdd does
+		PCGExMovingAverage::SmoothChannel<FVector>(
+			InBlending.RotationBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].Transform.Rotator().Euler(); },
+			[&](const int32 i, const FVector& V) { OutPoints[i].Transform.SetRotation(FRotator::MakeFromEuler(V).Quaternion().GetNormalized()); });
+
+		PCGExMovingAverage::SmoothChannel<FVector>(
+			InBlending.ScaleBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return InPoints[i].Transform.GetScale3D(); },
+			[&](const int32 i, const FVector& V) { OutPoints[i].Transform.SetScale3D(V); });
+
+		PCGExMovingAverage::SmoothChannel<double>(
+			InBlending.SteepnessBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return static_cast<double>(InPoints[i].Steepness); },
+			[&](const int32 i, const double V) { OutPoints[i].Steepness = V; });
+
+		PCGExMovingAverage::SmoothChannel<double>(
+			InBlending.SeedBlending, Windows, bClosedLoop,
+			[&](const int32 i) { return static_cast<double>(InPoints[i].Seed); },
+			[&](const int32 i, const double V) { OutPoints[i].Seed = static_cast<int32>(V); });
+	}
 };
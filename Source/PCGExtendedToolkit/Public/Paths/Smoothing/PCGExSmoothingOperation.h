@@ -26,4 +26,19 @@ public:
 		const bool bClosedLoop)
 	{
 	}
+
+	/** Whether this method can smooth the given point properties over the whole path at once through SmoothProperties. */
+	virtual bool CanSmoothProperties(const FPCGExPropertiesBlendingDetails& InBlending) const { return false; }
+
+	/**
+	 * Smooth point properties of the whole path at once, from In to Out.
+	 * A smoothing amount of 0 leaves the point untouched.
+	 */
+	virtual void SmoothProperties(
+		const TSharedRef<PCGExData::FPointIO>& Path,
+		const FPCGExPropertiesBlendingDetails& InBlending,
+		const TArrayView<const double>& SmoothingAmounts,
+		const bool bClosedLoop)
+	{
+	}
 };
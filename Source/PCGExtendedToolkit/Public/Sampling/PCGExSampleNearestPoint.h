@@ -322,6 +322,8 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestPointContext final : FPCGEx
 	TSharedPtr<PCGExDetails::FDistances> DistanceDetails;
 	FPCGExBlendingDetails BlendingDetails;
 	const TArray<FPCGPoint>* TargetPoints = nullptr;
+	TConstArrayView<FVector> TargetPositions;
+	bool bCenterToCenterDistance = false; // Distances only need target positions
 	int32 NumTargets = 0;
 
 	FRuntimeFloatCurve RuntimeWeightCurve;
@@ -10,6 +10,7 @@
 #include "PCGExPointsProcessor.h"
 #include "PCGExSampling.h"
 #include "Data/PCGExDataForward.h"
+#include "Geometry/PCGExGeoBVH.h"
 
 
 #include "PCGExSampleNearestSurface.generated.h"
@@ -73,6 +74,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="SurfaceSource==EPCGExSurfaceSource::ActorReferences", EditConditionHides))
 	FName ActorReference = FName("ActorReference");
 
+	/** If enabled, triangles of included static meshes are extracted once and queried on the CPU instead of going through the physics scene. Other primitives still rely on physics. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, EditCondition="SurfaceSource==EPCGExSurfaceSource::ActorReferences", EditConditionHides))
+	bool bUseTriangleBVH = false;
+
 	/** Search max distance */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, CLampMin=0.001))
 	double MaxDistance = 1000;
@@ -198,6 +203,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestSurfaceContext final : FPCG
 	bool bUseInclude = false;
 	TMap<AActor*, int32> IncludedActors;
 	TArray<UPrimitiveComponent*> IncludedPrimitives;
+	TSharedPtr<PCGExGeo::FTriangleBVH> TriangleBVH;
 
 	PCGEX_FOREACH_FIELD_NEARESTSURFACE(PCGEX_OUTPUT_DECL_TOGGLE)
 };
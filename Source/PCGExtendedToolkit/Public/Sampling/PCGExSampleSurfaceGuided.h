@@ -10,6 +10,7 @@
 #include "PCGExSampling.h"
 #include "PCGExTexParamFactoryProvider.h"
 #include "Data/PCGExDataForward.h"
+#include "Geometry/PCGExGeoBVH.h"
 
 
 #include "PCGExSampleSurfaceGuided.generated.h"
@@ -111,6 +112,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="DistanceInput==EPCGExTraceSampleDistanceInput::Attribute", EditConditionHides))
 	FPCGAttributePropertyInputSelector LocalMaxDistance;
 
+	/** If enabled, static meshes around the traces are gathered once per input, and their triangles are traced on the CPU in packets instead of going through the physics scene. Other primitives are traced individually. UV Coords are not supported in this mode. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable))
+	bool bUseTriangleBVH = false;
+
 	/** Write whether the sampling was sucessful or not to a boolean attribute. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta=(PCG_NotOverridable, InlineEditConditionToggle))
 	bool bWriteSuccess = false;
@@ -308,6 +313,12 @@ namespace PCGExSampleSurfaceGuided
 		int8 bAnySuccess = 0;
 		UWorld* World = nullptr;
 
+		bool bUseTriangleBVH = false;
+		TSharedPtr<PCGExMT::TScopedValue<FBox>> TraceBounds;
+		TSharedPtr<PCGExGeo::FTriangleBVH> TriangleBVH;
+		TArray<UPrimitiveComponent*> FallbackPrimitives;
+		TArray<PCGExGeo::FTriangleHit> TriangleHits;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TPointsProcessor(InPointDataFacade)
@@ -317,6 +328,17 @@ namespace PCGExSampleSurfaceGuided
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
+
+		FORCEINLINE void GetTrace(const int32 Index, FVector& OutOrigin, FVector& OutDirection, double& OutMaxDistance) const
+		{
+			OutDirection = DirectionGetter->Read(Index).GetSafeNormal();
+			OutOrigin = OriginGetter->Read(Index);
+			OutMaxDistance = MaxDistanceGetter ? MaxDistanceGetter->Read(Index) : Settings->DistanceInput == EPCGExTraceSampleDistanceInput::Constant ? Settings->MaxDistance : OutDirection.Length();
+		}
+
+		void GatherTraceCandidates();
+		void TraceScope(const PCGExMT::FScope& Scope);
+
 		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void PrepareSingleLoopScopeForPoints(const PCGExMT::FScope& Scope) override;
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const PCGExMT::FScope& Scope) override;
@@ -166,8 +166,6 @@ namespace PCGExSampling
 
 		check(InMutablePoints.Num() == NumSamples);
 
-		int32 WriteIndex = 0;
-		for (int32 i = 0; i < NumSamples; i++) { if (InSampleState[i]) { InMutablePoints[WriteIndex++] = InMutablePoints[i]; } }
-		InMutablePoints.SetNum(WriteIndex);
+		PCGExMT::Compact(InMutablePoints, [&](const int32 Index) { return InSampleState[Index] != 0; });
 	}
 }